@@ -0,0 +1,43 @@
+/*
+ * Header file automatically generated by ./configure.
+ * Tweaking this file may seem like a good temporary workaround
+ * than tweak the file, but you probably should fix the script
+ * to do the job. In any case, be aware that you will lose your
+ * changes if you re-run ./configure.
+ */
+#define trunc txr_trunc
+#define floorf txr_floorf
+#define random txr_random
+#define longlong_t txr_longlong_t
+#define HAVE_LONGLONG_T 1
+typedef long long longlong_t;
+#define HAVE_ULONGLONG_T 1
+typedef unsigned long long ulonglong_t;
+#define HAVE_SUPERLONG_T 1
+typedef __int128 superlong_t;
+#define HAVE_USUPERLONG_T 1
+typedef __uint128_t usuperlong_t;
+#define SIZEOF_SHORT 2
+#define SIZEOF_INT 4
+#define SIZEOF_LONG 8
+#define SIZEOF_PTR 8
+#define SIZEOF_LONGLONG_T 8
+#define SIZEOF_SUPERLONG_T 16
+typedef long int_ptr_t;
+#define HAVE_UINTPTR_T 1
+typedef unsigned long uint_ptr_t;
+#define INT_PTR_MAX (((((long) 1 << 62) - 1) << 1) + 1)
+#define INT_PTR_MIN (-INT_PTR_MAX)
+#define HAVE_DOUBLE_INTPTR_T 1
+typedef superlong_t double_intptr_t;
+#define LIT_ALIGN 4
+#define INLINE static __inline__
+#define HAVE_SYS_WAIT 1
+#define HAVE_ENVIRON 1
+#define HAVE_PTHREADS 1
+#define HAVE_TM_GMTOFF 1
+#define TM_GMTOFF __tm_gmtoff
+#define HAVE_TM_ZONE 1
+#define TM_ZONE __tm_zone
+#define CONFIG_DEBUG_SUPPORT 1
+#define HAVE_MMAP 1
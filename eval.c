@@ -383,11 +383,17 @@ static val do_eval_args(val form, val env, val ctx_form,
 
 val interp_fun(val env, val fun, val args)
 {
+  gc_frame_t fr;
   val def = cdr(fun);
   val params = car(def);
   val body = cdr(def);
   val fun_env = bind_args(env, params, args, fun);
-  return eval_progn(body, fun_env, body);
+  val result;
+
+  gc_frame_begin(&fr, &fun_env, &body, (val *) 0);
+  result = eval_progn(body, fun_env, body);
+  gc_frame_end(&fr);
+  return result;
 }
 
 static val eval_intrinsic(val form, val env)
@@ -2230,9 +2236,13 @@ void eval_init(void)
   reg_fun(intern(lit("min"), user_package), func_n1v(minv));
 
   reg_fun(intern(lit("regex-compile"), user_package), func_n1(regex_compile));
+  reg_fun(intern(lit("regex-cache-stats"), user_package),
+          func_n0(regex_cache_stats));
   reg_fun(intern(lit("regexp"), user_package), func_n1(regexp));
   reg_fun(intern(lit("search-regex"), user_package), func_n4o(search_regex, 2));
   reg_fun(intern(lit("match-regex"), user_package), func_n3o(match_regex, 2));
+  reg_fun(intern(lit("match-regex-groups"), user_package),
+          func_n3o(match_regex_groups, 2));
   reg_fun(intern(lit("regsub"), user_package), func_n3(regsub));
 
 
@@ -2244,6 +2254,7 @@ void eval_init(void)
   reg_fun(intern(lit("pushhash"), user_package), func_n3(pushhash));
   reg_fun(intern(lit("remhash"), user_package), func_n2(remhash));
   reg_fun(intern(lit("hash-count"), user_package), func_n1(hash_count));
+  reg_fun(intern(lit("intern-str"), user_package), func_n1(intern_str));
   reg_fun(intern(lit("get-hash-userdata"), user_package),
           func_n1(get_hash_userdata));
   reg_fun(intern(lit("set-hash-userdata"), user_package),
@@ -2420,6 +2431,13 @@ void eval_init(void)
   reg_fun(intern(lit("time"), user_package), func_n0(time_sec));
   reg_fun(intern(lit("time-usec"), user_package), func_n0(time_sec_usec));
 
+  reg_fun(intern(lit("gc-scan-time"), user_package), func_n0(gc_scan_time));
+  reg_fun(intern(lit("gc-stats"), user_package), func_n0(gc_stats));
+  reg_fun(intern(lit("gc"), user_package), func_n0(gc_collect));
+  reg_fun(intern(lit("gc-state"), user_package), func_n1(gc_set_state));
+  reg_fun(intern(lit("gc-params"), user_package), func_n0(gc_get_params));
+  reg_fun(intern(lit("set-gc-param"), user_package), func_n2(gc_set_param));
+
   reg_fun(intern(lit("source-loc"), user_package), func_n1(source_loc));
   reg_fun(intern(lit("source-loc-str"), user_package), func_n1(source_loc_str));
 
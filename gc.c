@@ -31,12 +31,24 @@
 #include <setjmp.h>
 #include <dirent.h>
 #include <wchar.h>
+#include <string.h>
+#include <stddef.h>
+#include <sys/time.h>
 #include "config.h"
+#if HAVE_MMAP
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+#if HAVE_PTHREADS
+#include <pthread.h>
+#include <sched.h>
+#endif
 #ifdef HAVE_VALGRIND
 #include <valgrind/memcheck.h>
 #endif
 #include "lib.h"
 #include "stream.h"
+#include "unwind.h"
 #include "hash.h"
 #include "txr.h"
 #include "eval.h"
@@ -44,20 +56,97 @@
 
 #define PROT_STACK_SIZE         1024
 #define HEAP_SIZE               16384
-#define CHECKOBJ_VEC_SIZE       (2 * HEAP_SIZE)
 #define FULL_GC_INTERVAL        40
-#define FRESHOBJ_VEC_SIZE       (2 * HEAP_SIZE)
+#define NURSERY_SIZE            (8 * HEAP_SIZE)
+#define LIVE_PERCENT            50
+#define MIN_FREE                (3 * HEAP_SIZE / 4)
+#define MINOR_MIN_FREE          (HEAP_SIZE / 4)
+#define MIN_HEAPS_MAX           65536
+#define CLEAR_STACK_MAX         (1024 * 1024)
+#define CLEAR_CHUNK             256
+#define PAUSE_BUCKETS           16
+#define PAUSE_MIN_USEC          64
 
-typedef struct heap {
+/*
+ * Each heap occupies a naturally aligned region of HEAP_BYTES, so that
+ * the heap containing an object is found by masking the object's address.
+ * The heap header, with the mark and allocation bitmaps, sits at the
+ * start of the region, and the object cells fill the remainder.
+ * HEAP_BYTES must be a power of two, so it is based on the object
+ * size rounded down to a power of two; a heap holds at most HEAP_SIZE
+ * objects.
+ */
+#define OBJ_SIZE_POW2           (sizeof (obj_t) >= 64 ? 64 :            \
+                                 sizeof (obj_t) >= 32 ? 32 : 16)
+#define HEAP_BYTES              (HEAP_SIZE * OBJ_SIZE_POW2)
+#define HEAP_CELLS              ((HEAP_BYTES - sizeof (struct heap_header)) \
+                                 / sizeof (obj_t))
+#define MARK_BITS               (sizeof (unsigned long) * CHAR_BIT)
+#define MARK_CELLS              ((HEAP_SIZE + MARK_BITS - 1) / MARK_BITS)
+
+#define SMALL_GRAIN             16
+#define SMALL_MAX               512
+#define SMALL_CLASSES           (SMALL_MAX / SMALL_GRAIN)
+#define ARENA_BYTES             65536
+#define ARENA_CHUNK             16
+#define ARENA_HEADER            ((sizeof (arena_t) + SMALL_GRAIN - 1) \
+                                 / SMALL_GRAIN * SMALL_GRAIN)
+
+#if CONFIG_GEN_GC
+#define CARD_SIZE               64
+#define CARDS_PER_HEAP          (HEAP_SIZE / CARD_SIZE)
+#define CARD_CELL_BITS          (sizeof (unsigned int) * CHAR_BIT)
+#define CARD_CELLS              (CARDS_PER_HEAP / CARD_CELL_BITS)
+#endif
+
+struct heap_header {
   struct heap *next;
-  obj_t block[HEAP_SIZE];
+  mem_t *mem; /* malloced block holding the heap; null if mapped */
+  /*
+   * Side-table bitmaps, one bit per object cell. A bit in marks is set
+   * when the object is found reachable; a bit in alloc is set while the
+   * cell is allocated (not on the free list). The sweep works on
+   * these a word at a time, and only visits the cells which are
+   * allocated but not marked.
+   */
+  unsigned long marks[MARK_CELLS];
+  unsigned long alloc[MARK_CELLS];
+  int pending;
+  int release;
+#if CONFIG_GEN_GC
+  /*
+   * Card tables. A set bit in fresh_cards means that the corresponding
+   * range of CARD_SIZE objects contains objects allocated since the
+   * last collection. A set bit in rem_cards means that the card contains
+   * objects in the remembered set: young objects stored into older
+   * objects, or older objects which were mutated. The dirty flag
+   * indicates that either table has bits set.
+   */
+  unsigned int fresh_cards[CARD_CELLS];
+  unsigned int rem_cards[CARD_CELLS];
+  int dirty;
+#endif
+};
+
+typedef struct heap {
+  struct heap_header h;
+  obj_t block[HEAP_CELLS];
 } heap_t;
 
 typedef struct mach_context {
   jmp_buf buf;
 } mach_context_t;
 
+/*
+ * The jmp_buf may hold some registers in mangled form, hiding any
+ * object pointers in them from the stack scan. GCC can be told to
+ * spill all callee-saved registers into the frame, which is scanned.
+ */
+#if __GNUC__
+#define save_context(X) (__builtin_unwind_init(), setjmp((X).buf))
+#else
 #define save_context(X) setjmp((X).buf)
+#endif
 
 int opt_gc_debug;
 #ifdef HAVE_VALGRIND
@@ -69,20 +158,82 @@ static val *prot_stack[PROT_STACK_SIZE];
 static val **prot_stack_limit = prot_stack + PROT_STACK_SIZE;
 static val **top = prot_stack;
 
+/*
+ * Frames registered by recursive functions, innermost first.
+ */
+static gc_frame_t *gc_frames;
+static int stack_grows_down;
+
 static val free_list, *free_tail = &free_list;
 static heap_t *heap_list;
 static val heap_min_bound, heap_max_bound;
 
+/*
+ * Index of all heaps, sorted by address, for in_heap.
+ */
+static heap_t **heap_index;
+static cnum heap_count, heap_index_size;
+
+static cnum stack_scan_usec;
+static cnum alloc_count, live_count;
+static heap_t *sweep_pending;
+
+/*
+ * Heap sizing policy: after a full collection, the heap is sized so that
+ * live objects make up about gc_live_percent of it, with at least
+ * gc_min_free cells free, and no fewer than gc_min_heaps heaps.
+ */
+cnum gc_live_percent = LIVE_PERCENT;
+cnum gc_min_free = MIN_FREE;
+cnum gc_min_heaps = 1;
+static cnum heap_target;
+
+/*
+ * Bytes of dead stack to clear when a registered frame is
+ * left after a collection, so that stale words do not retain
+ * garbage; zero disables.
+ */
+cnum gc_clear_stack;
+static cnum stack_cleared_gcs;
+
+static int sweep_lazily(void);
+
+/*
+ * Statistics, reported by gc_stats. Pause times are counted in a
+ * histogram whose first bucket takes pauses under PAUSE_MIN_USEC,
+ * each next bucket doubling the limit; the last bucket is unbounded.
+ */
+static cnum stat_minor, stat_full, stat_grow, stat_release, stat_swept;
+static cnum stat_mark_usec, stat_sweep_usec, stat_pause_usec, stat_pause_max;
+static cnum stat_pause_hist[PAUSE_BUCKETS];
+
 int gc_enabled = 1;
 
 #if CONFIG_GEN_GC
-static val checkobj[CHECKOBJ_VEC_SIZE];
-static int checkobj_idx;
-static val freshobj[FRESHOBJ_VEC_SIZE];
-static int freshobj_idx;
+cnum gc_nursery_size = NURSERY_SIZE;
+cnum gc_full_interval = FULL_GC_INTERVAL;
+cnum gc_minor_min_free = MINOR_MIN_FREE;
+static cnum fresh_count;
 static int full_gc;
 #endif
 
+/*
+ * Tuning parameters, settable by command line options and
+ * by the set-gc-param function.
+ */
+struct gc_param gc_params[] = {
+  { "live-percent", &gc_live_percent, 1, 100 },
+  { "min-free", &gc_min_free, 0, NUM_MAX / 4 },
+  { "min-heaps", &gc_min_heaps, 1, MIN_HEAPS_MAX },
+  { "clear-stack", &gc_clear_stack, 0, CLEAR_STACK_MAX },
+#if CONFIG_GEN_GC
+  { "minor-min-free", &gc_minor_min_free, 0, NUM_MAX / 4 },
+  { "nursery-size", &gc_nursery_size, 1, NUM_MAX / 4 },
+  { "full-interval", &gc_full_interval, 1, NUM_MAX / 4 },
+#endif
+  { 0, 0, 0, 0 }
+};
+
 #if EXTRA_DEBUGGING
 static val break_obj;
 #endif
@@ -129,15 +280,228 @@ void release(val *last, ...)
   va_end (vl);
 }
 
+/*
+ * A frame registers the addresses of a function's local variables
+ * as precise roots. Unlike prot1, frames need not be released by
+ * functions that are unwound: gc_frame_unwind discards them.
+ */
+void gc_frame_begin(gc_frame_t *fr, ...)
+{
+  val *next;
+  va_list vl;
+  va_start (vl, fr);
+
+  fr->nroots = 0;
+  fr->gcs = stat_minor + stat_full;
+
+  while ((next = va_arg(vl, val *)) != 0) {
+    assert (fr->nroots < GC_FRAME_ROOTS);
+    fr->root[fr->nroots++] = next;
+  }
+
+  va_end (vl);
+
+  fr->up = gc_frames;
+  gc_frames = fr;
+}
+
+static val clear_stack(cnum chunks)
+{
+  volatile val buf[CLEAR_CHUNK];
+  int i;
+
+  for (i = 0; i < CLEAR_CHUNK; i++)
+    buf[i] = nil;
+
+  if (chunks > 1)
+    buf[0] = clear_stack(chunks - 1); /* not a tail call */
+
+  return buf[0];
+}
+
+/*
+ * If there was a collection since the frame was registered, the
+ * stack below it is likely full of dead pointers; these would be
+ * picked up as roots by callees which leave their stack slots
+ * uninitialized. Clear it, but only once per collection.
+ */
+void gc_frame_end(gc_frame_t *fr)
+{
+  cnum gcs = stat_minor + stat_full;
+
+  gc_frames = fr->up;
+
+  if (gc_clear_stack && fr->gcs != gcs && stack_cleared_gcs != gcs) {
+    stack_cleared_gcs = gcs;
+    clear_stack((gc_clear_stack + sizeof (val) * CLEAR_CHUNK - 1) /
+                (sizeof (val) * CLEAR_CHUNK));
+  }
+}
+
+/*
+ * Called before a nonlocal exit to the unwind frame at exit_point:
+ * drops the frames of the functions being abandoned.
+ */
+void gc_frame_unwind(mem_t *exit_point)
+{
+  val *limit = (val *) exit_point;
+
+  while (gc_frames && (stack_grows_down ? (val *) gc_frames < limit
+                                        : (val *) gc_frames > limit))
+    gc_frames = gc_frames->up;
+}
+
+static void heap_index_insert(heap_t *heap)
+{
+  cnum lo = 0, hi = heap_count;
+
+  if (heap_count >= heap_index_size) {
+    heap_index_size = heap_index_size ? 2 * heap_index_size : 16;
+    heap_index = (heap_t **) chk_realloc((mem_t *) heap_index,
+                                         heap_index_size * sizeof *heap_index);
+  }
+
+  while (lo < hi) {
+    cnum mid = lo + (hi - lo) / 2;
+    if (heap_index[mid] < heap)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  memmove(heap_index + lo + 1, heap_index + lo,
+          (heap_count - lo) * sizeof *heap_index);
+  heap_index[lo] = heap;
+  heap_count++;
+}
+
+static heap_t *heap_of(val obj)
+{
+  return (heap_t *) ((uint_ptr_t) obj & ~(uint_ptr_t) (HEAP_BYTES - 1));
+}
+
+#if CONFIG_GEN_GC
+
+static void card_set_fresh(heap_t *heap, val obj)
+{
+  cnum card = (obj - heap->block) / CARD_SIZE;
+  heap->h.fresh_cards[card / CARD_CELL_BITS] |= 1U << (card % CARD_CELL_BITS);
+  heap->h.dirty = 1;
+}
+
+static void card_set_rem(val obj)
+{
+  heap_t *heap = heap_of(obj);
+  cnum card = (obj - heap->block) / CARD_SIZE;
+  heap->h.rem_cards[card / CARD_CELL_BITS] |= 1U << (card % CARD_CELL_BITS);
+  heap->h.dirty = 1;
+}
+
+static void cards_clear(void)
+{
+  cnum i;
+
+  for (i = 0; i < heap_count; i++) {
+    heap_t *heap = heap_index[i];
+    if (heap->h.dirty) {
+      memset(heap->h.fresh_cards, 0, sizeof heap->h.fresh_cards);
+      memset(heap->h.rem_cards, 0, sizeof heap->h.rem_cards);
+      heap->h.dirty = 0;
+    }
+  }
+}
+
+#endif
+
+/*
+ * Obtain a naturally aligned region of HEAP_BYTES for a heap. With mmap,
+ * twice that is mapped and the misaligned excess at either end is
+ * unmapped again, so that the heap costs exactly HEAP_BYTES, and can
+ * be returned to the system by heap_free. Otherwise, posix_memalign is
+ * asked for exactly HEAP_BYTES, if it exists. Failing that, a block
+ * twice the size is taken from malloc. The address to give to free is
+ * kept in the header.
+ */
+#if HAVE_MMAP && !defined MAP_ANONYMOUS
+static int zero_fd = -1;
+#endif
+
+static heap_t *heap_alloc(void)
+{
+  mem_t *mem;
+
+#if HAVE_MMAP
+  {
+    int flags = MAP_PRIVATE, fd = -1;
+    mem_t *end, *aligned;
+
+#ifdef MAP_ANONYMOUS
+    flags |= MAP_ANONYMOUS;
+#else
+    if (zero_fd == -1)
+      zero_fd = open("/dev/zero", O_RDWR);
+    fd = zero_fd;
+#endif
+
+    mem = (mem_t *) mmap(0, 2 * HEAP_BYTES, PROT_READ | PROT_WRITE,
+                         flags, fd, 0);
+
+    if (mem != (mem_t *) MAP_FAILED) {
+      end = mem + 2 * HEAP_BYTES;
+      aligned = (mem_t *) (((uint_ptr_t) mem + HEAP_BYTES - 1)
+                           & ~(uint_ptr_t) (HEAP_BYTES - 1));
+      if (aligned > mem)
+        munmap(mem, aligned - mem);
+      if (end > aligned + HEAP_BYTES)
+        munmap(aligned + HEAP_BYTES, end - (aligned + HEAP_BYTES));
+      ((heap_t *) aligned)->h.mem = 0;
+      return (heap_t *) aligned;
+    }
+  }
+#endif
+
+#if HAVE_POSIX_MEMALIGN
+  {
+    extern int posix_memalign(void **, size_t, size_t);
+    void *ptr;
+
+    if (posix_memalign(&ptr, HEAP_BYTES, HEAP_BYTES) == 0) {
+      ((heap_t *) ptr)->h.mem = (mem_t *) ptr;
+      return (heap_t *) ptr;
+    }
+  }
+#endif
+
+  mem = chk_malloc(2 * HEAP_BYTES);
+
+  {
+    heap_t *heap = (heap_t *) (((uint_ptr_t) mem + HEAP_BYTES - 1)
+                               & ~(uint_ptr_t) (HEAP_BYTES - 1));
+    heap->h.mem = mem;
+    return heap;
+  }
+}
+
+static void heap_free(heap_t *heap)
+{
+#if HAVE_MMAP
+  if (heap->h.mem == 0) {
+    munmap((mem_t *) heap, HEAP_BYTES);
+    return;
+  }
+#endif
+  free(heap->h.mem);
+}
+
 static void more(void)
 {
-  heap_t *heap = (heap_t *) chk_malloc(sizeof *heap);
-  obj_t *block = heap->block, *end = heap->block + HEAP_SIZE;
+  heap_t *heap = heap_alloc();
+  obj_t *block = heap->block, *end = heap->block + HEAP_CELLS;
 
   if (end > heap_max_bound)
     heap_max_bound = end;
 
-  if (block < heap_min_bound)
+  if (heap_min_bound == 0 || block < heap_min_bound)
     heap_min_bound = block;
 
   while (block < end) {
@@ -148,9 +512,23 @@ static void more(void)
 
   free_tail = &heap->block[0].t.next;
 
-  heap->next = heap_list;
+  heap->h.next = heap_list;
   heap_list = heap;
 
+  memset(heap->h.marks, 0, sizeof heap->h.marks);
+  memset(heap->h.alloc, 0, sizeof heap->h.alloc);
+  heap->h.pending = 0;
+  heap->h.release = 0;
+
+#if CONFIG_GEN_GC
+  memset(heap->h.fresh_cards, 0, sizeof heap->h.fresh_cards);
+  memset(heap->h.rem_cards, 0, sizeof heap->h.rem_cards);
+  heap->h.dirty = 0;
+#endif
+
+  heap_index_insert(heap);
+  stat_grow++;
+
 #ifdef HAVE_VALGRIND
   if (opt_vg_debug)
     VALGRIND_MAKE_MEM_NOACCESS(&heap->block, sizeof heap->block);
@@ -162,18 +540,18 @@ val make_obj(void)
   int tries;
 
 #if CONFIG_GEN_GC
-  if (opt_gc_debug || freshobj_idx >= FRESHOBJ_VEC_SIZE) {
+  if (opt_gc_debug || fresh_count >= gc_nursery_size)
     gc();
-    assert (freshobj_idx < FRESHOBJ_VEC_SIZE);
-  }
 #else
   if (opt_gc_debug)
     gc();
 #endif
 
   for (tries = 0; tries < 3; tries++) {
-    if (free_list) {
+    if (free_list || sweep_lazily()) {
       val ret = free_list;
+      heap_t *heap = heap_of(ret);
+      cnum i = ret - heap->block;
 #ifdef HAVE_VALGRIND
       if (opt_vg_debug)
         VALGRIND_MAKE_MEM_DEFINED(free_list, sizeof *free_list);
@@ -183,15 +561,27 @@ val make_obj(void)
       if (opt_vg_debug)
         VALGRIND_MAKE_MEM_UNDEFINED(ret, sizeof *ret);
 #endif
+      heap->h.alloc[i / MARK_BITS] |= 1UL << (i % MARK_BITS);
+      alloc_count++;
+      /* Object allocated into heap not yet swept must not be
+         reclaimed by that sweep. */
+      if (heap->h.pending)
+        heap->h.marks[i / MARK_BITS] |= 1UL << (i % MARK_BITS);
 #if CONFIG_GEN_GC
       ret->t.gen = 0;
-      freshobj[freshobj_idx++] = ret;
+      card_set_fresh(heap, ret);
+      fresh_count++;
 #endif
       return ret;
     }
 
     switch (tries) {
-    case 0: gc(); break;
+    case 0:
+      if (heap_count < gc_min_heaps)
+        more();
+      else
+        gc();
+      break;
     case 1: more(); break;
     }
   }
@@ -199,6 +589,252 @@ val make_obj(void)
   return 0;
 }
 
+/*
+ * Allocator for the payloads of strings and vectors. Requests of up to
+ * SMALL_MAX bytes are served from arenas, each of which is divided into
+ * blocks of one size class. This spares short strings a malloc and free
+ * each. Arenas are aligned on ARENA_BYTES and carved out of chunks of
+ * ARENA_CHUNK arenas; whether a payload is in an arena is determined from
+ * the chunk index. Larger requests are passed to malloc.
+ *
+ * Each arena keeps its own list of freed blocks, and a count of the blocks
+ * in use. The arenas of a class which have room are kept on a list for the
+ * class. An arena whose blocks are all freed goes back to the pool, from
+ * which it can be given to any class, and a chunk whose arenas are all in
+ * the pool is freed by the next collection, so that memory taken for one
+ * size of string is not kept for good. One empty chunk is kept in reserve.
+ */
+typedef struct arena {
+  struct arena *next, *prev;
+  size_t block_size;
+  char *bump, *end;
+  mem_t *free;
+  cnum live;
+} arena_t;
+
+typedef struct arena_chunk {
+  char *base;
+  mem_t *mem;
+  int used;
+} arena_chunk_t;
+
+static arena_t *small_arena[SMALL_CLASSES];
+static arena_t *arena_pool;
+static arena_chunk_t *chunk_index;
+static cnum chunk_count, chunk_index_size;
+
+static void arena_link(arena_t **list, arena_t *arena)
+{
+  arena->prev = 0;
+  arena->next = *list;
+  if (*list)
+    (*list)->prev = arena;
+  *list = arena;
+}
+
+static void arena_unlink(arena_t **list, arena_t *arena)
+{
+  if (arena->prev)
+    arena->prev->next = arena->next;
+  else
+    *list = arena->next;
+  if (arena->next)
+    arena->next->prev = arena->prev;
+}
+
+static int arena_full(arena_t *arena)
+{
+  return arena->free == 0 && arena->bump + arena->block_size > arena->end;
+}
+
+static void chunk_index_insert(char *base, mem_t *mem)
+{
+  cnum lo = 0, hi = chunk_count;
+
+  if (chunk_count >= chunk_index_size) {
+    chunk_index_size = chunk_index_size ? 2 * chunk_index_size : 16;
+    chunk_index = (arena_chunk_t *) chk_realloc((mem_t *) chunk_index,
+                                                chunk_index_size *
+                                                sizeof *chunk_index);
+  }
+
+  while (lo < hi) {
+    cnum mid = lo + (hi - lo) / 2;
+    if (chunk_index[mid].base < base)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  memmove(chunk_index + lo + 1, chunk_index + lo,
+          (chunk_count - lo) * sizeof *chunk_index);
+  chunk_index[lo].base = base;
+  chunk_index[lo].mem = mem;
+  chunk_index[lo].used = 0;
+  chunk_count++;
+}
+
+static arena_chunk_t *chunk_of(mem_t *ptr)
+{
+  cnum lo = 0, hi = chunk_count;
+  char *p = (char *) ptr;
+
+  if (chunk_count == 0 || p < chunk_index[0].base)
+    return 0;
+
+  while (hi - lo > 1) {
+    cnum mid = lo + (hi - lo) / 2;
+    if (chunk_index[mid].base <= p)
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  if (p >= chunk_index[lo].base + ARENA_CHUNK * ARENA_BYTES)
+    return 0;
+
+  return &chunk_index[lo];
+}
+
+static arena_t *arena_of(mem_t *ptr)
+{
+  if (!chunk_of(ptr))
+    return 0;
+  return (arena_t *) ((uint_ptr_t) ptr & ~(uint_ptr_t) (ARENA_BYTES - 1));
+}
+
+static arena_t *arena_new(size_t block_size)
+{
+  arena_t *arena;
+
+  if (!arena_pool) {
+    mem_t *mem = chk_malloc((ARENA_CHUNK + 1) * ARENA_BYTES);
+    char *base = (char *) (((uint_ptr_t) mem + ARENA_BYTES - 1)
+                           & ~(uint_ptr_t) (ARENA_BYTES - 1));
+    int i;
+
+    chunk_index_insert(base, mem);
+
+    for (i = ARENA_CHUNK - 1; i >= 0; i--)
+      arena_link(&arena_pool, (arena_t *) (base + i * ARENA_BYTES));
+  }
+
+  arena = arena_pool;
+  arena_unlink(&arena_pool, arena);
+  chunk_of((mem_t *) arena)->used++;
+  arena->block_size = block_size;
+  arena->bump = (char *) arena + ARENA_HEADER;
+  arena->end = (char *) arena + ARENA_BYTES;
+  arena->free = 0;
+  arena->live = 0;
+  return arena;
+}
+
+static void arena_release(arena_t *arena)
+{
+  chunk_of((mem_t *) arena)->used--;
+  arena_link(&arena_pool, arena);
+}
+
+/*
+ * Free the chunks whose arenas are all in the pool, except one.
+ */
+static void arena_trim(void)
+{
+  cnum i, j;
+  int reserved = 0;
+
+  for (i = j = 0; i < chunk_count; i++) {
+    arena_chunk_t *chunk = &chunk_index[i];
+
+    if (chunk->used == 0 && reserved++) {
+      int k;
+      for (k = 0; k < ARENA_CHUNK; k++)
+        arena_unlink(&arena_pool, (arena_t *) (chunk->base + k * ARENA_BYTES));
+      free(chunk->mem);
+    } else {
+      chunk_index[j++] = *chunk;
+    }
+  }
+
+  chunk_count = j;
+}
+
+mem_t *gc_payload_alloc(size_t size)
+{
+  if (size > 0 && size <= SMALL_MAX) {
+    size_t cls = (size - 1) / SMALL_GRAIN;
+    size_t block_size = (cls + 1) * SMALL_GRAIN;
+    arena_t *arena = small_arena[cls];
+    mem_t *block;
+
+    if (!arena) {
+      arena = arena_new(block_size);
+      arena_link(&small_arena[cls], arena);
+    }
+
+    if ((block = arena->free) != 0) {
+      arena->free = *(mem_t **) block;
+    } else {
+      block = (mem_t *) arena->bump;
+      arena->bump += block_size;
+    }
+
+    arena->live++;
+
+    if (arena_full(arena))
+      arena_unlink(&small_arena[cls], arena);
+
+    return block;
+  }
+
+  return chk_malloc(size);
+}
+
+void gc_payload_free(mem_t *ptr)
+{
+  arena_t *arena = arena_of(ptr);
+
+  if (arena) {
+    size_t cls = arena->block_size / SMALL_GRAIN - 1;
+
+    if (arena_full(arena))
+      arena_link(&small_arena[cls], arena);
+
+    *(mem_t **) ptr = arena->free;
+    arena->free = ptr;
+
+    if (--arena->live == 0) {
+      arena_unlink(&small_arena[cls], arena);
+      arena_release(arena);
+    }
+  } else {
+    free(ptr);
+  }
+}
+
+mem_t *gc_payload_realloc(mem_t *old, size_t size)
+{
+  arena_t *arena;
+
+  if (old == 0)
+    return gc_payload_alloc(size);
+
+  if ((arena = arena_of(old)) != 0) {
+    mem_t *block;
+
+    if (size <= arena->block_size)
+      return old;
+
+    block = gc_payload_alloc(size);
+    memcpy(block, old, arena->block_size);
+    gc_payload_free(old);
+    return block;
+  }
+
+  return chk_realloc(old, size);
+}
+
 static void finalize(val obj)
 {
   switch (obj->t.type) {
@@ -216,11 +852,11 @@ static void finalize(val obj)
   case FLNUM:
     return;
   case STR:
-    free(obj->st.str);
+    gc_payload_free((mem_t *) obj->st.str);
     obj->st.str = 0;
     return;
   case VEC:
-    free(obj->v.vec-2);
+    gc_payload_free((mem_t *) (obj->v.vec-2));
     obj->v.vec = 0;
     return;
   case COBJ:
@@ -243,34 +879,85 @@ void cobj_destroy_free_op(val obj)
   free(obj->co.handle);
 }
 
-static void mark_obj(val obj)
+/*
+ * Marking uses an explicit stack rather than recursion. An object is
+ * marked when it is pushed, so that it is pushed at most once; popping
+ * it pushes its children.
+ */
+typedef struct mark_stack {
+  val *stack;
+  cnum top, size;
+  cnum live;
+  int worker;
+} mark_stack_t;
+
+static mark_stack_t mark_stack;
+static int mark_deferred;
+
+/*
+ * The stacks of the parallel mark workers have the worker flag set.
+ * They may be grown by worker threads, so they are allocated with plain
+ * realloc: chk_realloc updates unsynchronized globals, and its out of
+ * memory handling may throw, which must not happen off the main thread.
+ */
+static void mark_stack_push(mark_stack_t *ms, val obj)
 {
-  type_t t;
+  if (ms->top >= ms->size) {
+    ms->size = ms->size ? 2 * ms->size : 1024;
+    if (ms->worker) {
+      ms->stack = (val *) realloc(ms->stack, ms->size * sizeof *ms->stack);
+      if (ms->stack == 0)
+        abort();
+    } else {
+      ms->stack = (val *) chk_realloc((mem_t *) ms->stack,
+                                      ms->size * sizeof *ms->stack);
+    }
+  }
+  ms->stack[ms->top++] = obj;
+}
+
+static int mark_set(val obj, int atomic)
+{
+  heap_t *heap = heap_of(obj);
+  cnum i = obj - heap->block;
+  unsigned long bit = 1UL << (i % MARK_BITS);
+  unsigned long *word = &heap->h.marks[i / MARK_BITS];
+
+  if ((*word & bit) != 0)
+    return 0;
 
-#if 1
-tail_call:
-#define mark_obj_tail(o) do { obj = (o); goto tail_call; } while (0)
+#if HAVE_PTHREADS
+  if (atomic)
+    return (__sync_fetch_and_or(word, bit) & bit) == 0;
 #else
-#define mark_obj_tail(o) return mark_obj(o)
+  (void) atomic;
 #endif
 
+  *word |= bit;
+  return 1;
+}
+
+static void mark_push(mark_stack_t *ms, val obj)
+{
+  type_t t;
+
   if (!is_ptr(obj))
     return;
 
-  t = obj->t.type;
-
 #if CONFIG_GEN_GC
   if (!full_gc && obj->t.gen > 0)
     return;
 #endif
 
-  if ((t & REACHABLE) != 0)
+  if (!mark_set(obj, ms->worker))
     return;
 
+  t = obj->t.type;
+
   if ((t & FREE) != 0)
     abort();
 
-  obj->t.type = (type_t) (obj->t.type | REACHABLE);
+  ms->live++;
 
 #if EXTRA_DEBUGGING
   if (obj == break_obj)
@@ -285,23 +972,39 @@ tail_call:
   case BGNUM:
   case FLNUM:
     return;
+  default:
+    mark_stack_push(ms, obj);
+  }
+}
+
+#if HAVE_PTHREADS
+static void mark_defer_cobj(mark_stack_t *ms, val obj);
+#endif
+
+static void mark_children(mark_stack_t *ms, val obj)
+{
+  switch (obj->t.type) {
   case CONS:
-    mark_obj(obj->c.car);
-    mark_obj_tail(obj->c.cdr);
+    mark_push(ms, obj->c.car);
+    mark_push(ms, obj->c.cdr);
+    return;
   case STR:
-    mark_obj(obj->st.len);
-    mark_obj_tail(obj->st.alloc);
+    mark_push(ms, obj->st.len);
+    mark_push(ms, obj->st.alloc);
+    return;
   case SYM:
-    mark_obj(obj->s.name);
-    mark_obj(obj->s.value);
-    mark_obj_tail(obj->s.package);
+    mark_push(ms, obj->s.name);
+    mark_push(ms, obj->s.value);
+    mark_push(ms, obj->s.package);
+    return;
   case PKG:
-    mark_obj(obj->pk.name);
-    mark_obj_tail(obj->pk.symhash);
+    mark_push(ms, obj->pk.name);
+    mark_push(ms, obj->pk.symhash);
+    return;
   case FUN:
-    mark_obj(obj->f.env);
+    mark_push(ms, obj->f.env);
     if (obj->f.functype == FINTERP)
-      mark_obj_tail(obj->f.f.interp_fun);
+      mark_push(ms, obj->f.f.interp_fun);
     return;
   case VEC:
     {
@@ -309,39 +1012,313 @@ tail_call:
       val fill_ptr = obj->v.vec[-1];
       cnum i, fp = c_num(fill_ptr);
 
-      mark_obj(alloc_size);
-      mark_obj(fill_ptr);
+      mark_push(ms, alloc_size);
+      mark_push(ms, fill_ptr);
 
       for (i = 0; i < fp; i++)
-        mark_obj(obj->v.vec[i]);
+        mark_push(ms, obj->v.vec[i]);
     }
     return;
   case LCONS:
-    mark_obj(obj->lc.func);
-    mark_obj(obj->lc.car);
-    mark_obj_tail(obj->lc.cdr);
+    mark_push(ms, obj->lc.func);
+    mark_push(ms, obj->lc.car);
+    mark_push(ms, obj->lc.cdr);
+    return;
   case LSTR:
-    mark_obj(obj->ls.prefix);
-    mark_obj(obj->ls.opts);
-    mark_obj_tail(obj->ls.list);
+    mark_push(ms, obj->ls.prefix);
+    mark_push(ms, obj->ls.opts);
+    mark_push(ms, obj->ls.list);
+    return;
   case COBJ:
+    /* The mark operations of cobjs call back into gc_mark, and some of
+       them have side effects, so worker threads hand them to the
+       main thread. */
+#if HAVE_PTHREADS
+    if (ms->worker) {
+      mark_defer_cobj(ms, obj);
+      return;
+    }
+#endif
     obj->co.ops->mark(obj);
-    mark_obj_tail(obj->co.cls);
+    mark_push(ms, obj->co.cls);
+    return;
   case ENV:
-    mark_obj(obj->e.vbindings);
-    mark_obj(obj->e.fbindings);
-    mark_obj_tail(obj->e.up_env);
+    mark_push(ms, obj->e.vbindings);
+    mark_push(ms, obj->e.fbindings);
+    mark_push(ms, obj->e.up_env);
+    return;
+  default:
+    break;
   }
 
   assert (0 && "corrupt type field");
 }
 
+#if HAVE_PTHREADS
+
+#define MAX_GC_THREADS          64
+#define MARK_SHARE_THRESHOLD    64
+#define MARK_SERIAL_BUDGET      4096
+
+/*
+ * Parallel marking. Each worker has a private mark stack, and a shared
+ * stack guarded by a mutex. A worker whose private stack grows moves
+ * the older half of it into its shared stack, if that is empty.
+ * A worker which runs out of work takes from its own shared stack,
+ * or else steals half of another worker's shared stack. When all
+ * workers are idle, the round is over.
+ *
+ * Worker zero is the main thread; the others are created on demand
+ * and wait for the next round.
+ */
+typedef struct mark_worker {
+  mark_stack_t local;
+  mark_stack_t shared;
+  mark_stack_t cobjs;
+  pthread_mutex_t lock;
+  pthread_t thread;
+} mark_worker_t;
+
+int opt_gc_threads;
+
+static mark_worker_t *mark_workers;
+static int mark_nworkers;
+static volatile int mark_idle;
+static int mark_round, mark_done;
+static pthread_mutex_t mark_round_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mark_round_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t mark_round_end = PTHREAD_COND_INITIALIZER;
+
+static void mark_defer_cobj(mark_stack_t *ms, val obj)
+{
+  mark_worker_t *w = (mark_worker_t *) ((char *) ms
+                                        - offsetof(mark_worker_t, local));
+  mark_stack_push(&w->cobjs, obj);
+}
+
+static cnum shared_top(mark_worker_t *w)
+{
+  return *(volatile cnum *) &w->shared.top;
+}
+
+/*
+ * Move the bottom half of stack from to stack to.
+ */
+static void mark_split(mark_stack_t *from, mark_stack_t *to)
+{
+  cnum half = (from->top + 1) / 2, i;
+
+  for (i = 0; i < half; i++)
+    mark_stack_push(to, from->stack[i]);
+
+  memmove(from->stack, from->stack + half,
+          (from->top - half) * sizeof *from->stack);
+  from->top -= half;
+}
+
+static int mark_steal(mark_worker_t *w, mark_worker_t *victim)
+{
+  int got;
+  pthread_mutex_lock(&victim->lock);
+  if ((got = (victim->shared.top > 0)))
+    mark_split(&victim->shared, &w->local);
+  pthread_mutex_unlock(&victim->lock);
+  return got;
+}
+
+static int mark_find_work(mark_worker_t *w)
+{
+  int i, n = mark_nworkers, me = w - mark_workers;
+
+  if (shared_top(w) > 0 && mark_steal(w, w))
+    return 1;
+
+  for (i = 1; i < n; i++) {
+    mark_worker_t *victim = &mark_workers[(me + i) % n];
+    if (shared_top(victim) > 0 && mark_steal(w, victim))
+      return 1;
+  }
+
+  return 0;
+}
+
+static void mark_work(mark_worker_t *w)
+{
+  mark_stack_t *ms = &w->local;
+
+  for (;;) {
+    while (ms->top > 0) {
+      mark_children(ms, ms->stack[--ms->top]);
+
+      if (ms->top >= MARK_SHARE_THRESHOLD && shared_top(w) == 0) {
+        pthread_mutex_lock(&w->lock);
+        mark_split(ms, &w->shared);
+        pthread_mutex_unlock(&w->lock);
+      }
+    }
+
+    if (mark_find_work(w))
+      continue;
+
+    __sync_fetch_and_add(&mark_idle, 1);
+
+    for (;;) {
+      int i;
+
+      if (mark_idle == mark_nworkers)
+        return;
+
+      for (i = 0; i < mark_nworkers; i++)
+        if (shared_top(&mark_workers[i]) > 0)
+          break;
+
+      if (i < mark_nworkers) {
+        __sync_fetch_and_sub(&mark_idle, 1);
+        if (mark_find_work(w))
+          break;
+        __sync_fetch_and_add(&mark_idle, 1);
+      }
+
+      sched_yield();
+    }
+  }
+}
+
+static void *mark_thread(void *arg)
+{
+  mark_worker_t *w = (mark_worker_t *) arg;
+  int round = 0;
+
+  for (;;) {
+    pthread_mutex_lock(&mark_round_lock);
+    while (mark_round == round)
+      pthread_cond_wait(&mark_round_start, &mark_round_lock);
+    round = mark_round;
+    pthread_mutex_unlock(&mark_round_lock);
+
+    mark_work(w);
+
+    pthread_mutex_lock(&mark_round_lock);
+    if (++mark_done == mark_nworkers - 1)
+      pthread_cond_signal(&mark_round_end);
+    pthread_mutex_unlock(&mark_round_lock);
+  }
+
+  return 0;
+}
+
+static int mark_start_workers(void)
+{
+  int i, n = opt_gc_threads;
+
+  if (n > MAX_GC_THREADS)
+    n = MAX_GC_THREADS;
+
+  mark_workers = (mark_worker_t *) chk_malloc(n * sizeof *mark_workers);
+  memset(mark_workers, 0, n * sizeof *mark_workers);
+
+  for (i = 0; i < n; i++) {
+    mark_worker_t *w = &mark_workers[i];
+    w->local.worker = w->shared.worker = w->cobjs.worker = 1;
+    pthread_mutex_init(&w->lock, 0);
+    if (i > 0 && pthread_create(&w->thread, 0, mark_thread, w) != 0)
+      break;
+  }
+
+  return mark_nworkers = i;
+}
+
+static void mark_parallel(void)
+{
+  int i;
+
+  for (i = 0; mark_stack.top > 0; i = (i + 1) % mark_nworkers)
+    mark_stack_push(&mark_workers[i].shared,
+                    mark_stack.stack[--mark_stack.top]);
+
+  mark_idle = 0;
+
+  pthread_mutex_lock(&mark_round_lock);
+  mark_done = 0;
+  mark_round++;
+  pthread_cond_broadcast(&mark_round_start);
+  pthread_mutex_unlock(&mark_round_lock);
+
+  mark_work(&mark_workers[0]);
+
+  pthread_mutex_lock(&mark_round_lock);
+  while (mark_done < mark_nworkers - 1)
+    pthread_cond_wait(&mark_round_end, &mark_round_lock);
+  pthread_mutex_unlock(&mark_round_lock);
+
+  /* The cobjs found by the workers are now marked by this thread;
+     this pushes more work onto mark_stack. */
+  for (i = 0; i < mark_nworkers; i++) {
+    mark_worker_t *w = &mark_workers[i];
+
+    live_count += w->local.live;
+    w->local.live = 0;
+
+    while (w->cobjs.top > 0) {
+      val obj = w->cobjs.stack[--w->cobjs.top];
+      obj->co.ops->mark(obj);
+      mark_push(&mark_stack, obj->co.cls);
+    }
+  }
+}
+
+#endif
+
+/*
+ * Process the mark stack until it is empty. If parallel marking is
+ * enabled, and a serial budget is exceeded, the remaining work
+ * is handed to the worker threads.
+ */
+static void mark_drain(void)
+{
+#if HAVE_PTHREADS
+  cnum budget = MARK_SERIAL_BUDGET;
+#endif
+
+  mark_deferred = 1;
+
+  while (mark_stack.top > 0) {
+#if HAVE_PTHREADS
+    if (opt_gc_threads > 1 && budget-- <= 0 &&
+        (mark_nworkers > 1 || (!mark_workers && mark_start_workers() > 1)))
+    {
+      mark_parallel();
+      continue;
+    }
+#endif
+    mark_children(&mark_stack, mark_stack.stack[--mark_stack.top]);
+  }
+
+  live_count += mark_stack.live;
+  mark_stack.live = 0;
+  mark_deferred = 0;
+}
+
+static void mark_obj(val obj)
+{
+  mark_push(&mark_stack, obj);
+  if (!mark_deferred)
+    mark_drain();
+}
+
 void cobj_mark_op(val obj)
 {
 }
 
-static int in_heap(val ptr)
+/*
+ * Determine whether ptr points to an allocated object cell in one of the
+ * heaps. The candidate heap is found by masking the address; the heap
+ * index is then searched to confirm that it is one of ours, unless
+ * it is *last, the heap confirmed by the previous call.
+ */
+static int in_heap(val ptr, heap_t **last)
 {
+  cnum lo = 0, hi = heap_count, i;
   heap_t *heap;
 
   if (!is_ptr(ptr))
@@ -350,17 +1327,37 @@ static int in_heap(val ptr)
   if (ptr < heap_min_bound || ptr >= heap_max_bound)
     return 0;
 
-  for (heap = heap_list; heap != 0; heap = heap->next) {
-    if (ptr >= heap->block && ptr < heap->block + HEAP_SIZE)
-      if (((char *) ptr - (char *) heap->block) % sizeof (obj_t) == 0)
-        return 1;
+  heap = heap_of(ptr);
+
+  if (heap != *last) {
+    while (lo < hi) {
+      cnum mid = lo + (hi - lo) / 2;
+      if (heap_index[mid] < heap)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+    if (lo >= heap_count || heap_index[lo] != heap)
+      return 0;
+
+    *last = heap;
   }
 
-  return 0;
+  if (ptr < heap->block || ptr >= heap->block + HEAP_CELLS)
+    return 0;
+
+  if (((char *) ptr - (char *) heap->block) % sizeof (obj_t) != 0)
+    return 0;
+
+  i = ptr - heap->block;
+  return (heap->h.alloc[i / MARK_BITS] & (1UL << (i % MARK_BITS))) != 0;
 }
 
 static void mark_mem_region(val *low, val *high)
 {
+  heap_t *last = 0;
+
   if (low > high) {
     val *tmp = high;
     high = low;
@@ -372,28 +1369,62 @@ static void mark_mem_region(val *low, val *high)
 #ifdef HAVE_VALGRIND
     VALGRIND_MAKE_MEM_DEFINED(&maybe_obj, sizeof maybe_obj);
 #endif
-    if (in_heap(maybe_obj)) {
-#ifdef HAVE_VALGRIND
-      if (opt_vg_debug)
-        VALGRIND_MAKE_MEM_DEFINED(maybe_obj, SIZEOF_PTR);
-#endif
-      type_t t = maybe_obj->t.type;
-      if ((t & FREE) == 0) {
-        mark_obj(maybe_obj);
-      } else {
-#ifdef HAVE_VALGRIND
-        if (opt_vg_debug)
-          VALGRIND_MAKE_MEM_NOACCESS(maybe_obj, sizeof *maybe_obj);
-#endif
+    if (in_heap(maybe_obj, &last))
+      mark_obj(maybe_obj);
+    low++;
+  }
+}
+
+#if CONFIG_GEN_GC
+
+static void mark_remembered(void)
+{
+  cnum i, c;
+
+  for (i = 0; i < heap_count; i++) {
+    heap_t *heap = heap_index[i];
+
+    if (!heap->h.dirty)
+      continue;
+
+    for (c = 0; c < CARDS_PER_HEAP; c++) {
+      if (heap->h.rem_cards[c / CARD_CELL_BITS] & (1U << (c % CARD_CELL_BITS))) {
+        cnum j = c * CARD_SIZE, end = j + CARD_SIZE;
+
+        if (end > (cnum) HEAP_CELLS)
+          end = HEAP_CELLS;
+
+        for (; j < end; j++) {
+          if ((heap->h.alloc[j / MARK_BITS] & (1UL << (j % MARK_BITS))) &&
+              heap->block[j].t.gen < 0)
+            mark_obj(&heap->block[j]);
+        }
       }
     }
-    low++;
   }
 }
 
+#endif
+
+static cnum usec_now(void)
+{
+  struct timeval tv;
+  if (gettimeofday(&tv, 0) == -1)
+    return 0;
+  return (cnum) tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
 static void mark(mach_context_t *pmc, val *gc_stack_top)
 {
   val **rootloc;
+  gc_frame_t *fr;
+  cnum scan_start;
+
+  /*
+   * The roots are gathered onto the mark stack, which is
+   * then processed.
+   */
+  mark_deferred = 1;
 
   /*
    * First, scan the officially registered locations.
@@ -401,18 +1432,25 @@ static void mark(mach_context_t *pmc, val *gc_stack_top)
   for (rootloc = prot_stack; rootloc != top; rootloc++)
     mark_obj(**rootloc);
 
-#if CONFIG_GEN_GC
   /*
-   * Mark the additional objects indicated for marking.
+   * The roots registered by active frames.
    */
-  if (!full_gc)
-  {
+  for (fr = gc_frames; fr != 0; fr = fr->up) {
     int i;
-    for (i = 0; i < checkobj_idx; i++)
-      mark_obj(checkobj[i]);
+    for (i = 0; i < fr->nroots; i++)
+      mark_obj(*fr->root[i]);
   }
+
+#if CONFIG_GEN_GC
+  /*
+   * Mark the remembered set, found in the remembered cards.
+   */
+  if (!full_gc)
+    mark_remembered();
 #endif
 
+  scan_start = usec_now();
+
   /*
    * Then the machine context
    */
@@ -422,9 +1460,13 @@ static void mark(mach_context_t *pmc, val *gc_stack_top)
    * Finally, the stack.
    */
   mark_mem_region(gc_stack_top, gc_stack_bottom);
+
+  stack_scan_usec += usec_now() - scan_start;
+
+  mark_drain();
 }
 
-static int sweep_one(obj_t *block)
+static void sweep_one(obj_t *block)
 {
 #ifdef HAVE_VALGRIND
   const int vg_dbg = opt_vg_debug;
@@ -432,32 +1474,13 @@ static int sweep_one(obj_t *block)
   const int vg_dbg = 0;
 #endif
 
-#if CONFIG_GEN_GC
-  if (!full_gc && block->t.gen > 0)
-    abort();
-#endif
-
-  if ((block->t.type & (REACHABLE | FREE)) == (REACHABLE | FREE))
+  if (block->t.type & FREE)
     abort();
 
-  if (block->t.type & REACHABLE) {
-    block->t.type = (type_t) (block->t.type & ~REACHABLE);
-#if CONFIG_GEN_GC
-    block->t.gen = 1;
-#endif
-    return 0;
-  }
-
-  if (block->t.type & FREE) {
-#ifdef HAVE_VALGRIND
-    if (vg_dbg)
-      VALGRIND_MAKE_MEM_NOACCESS(block, sizeof *block);
-#endif
-    return 1;
-  }
-
   finalize(block);
   block->t.type = (type_t) (block->t.type | FREE);
+  alloc_count--;
+  stat_swept++;
 
   /* If debugging is turned on, we want to catch instances
      where a reachable object is wrongly freed. This is difficult
@@ -485,94 +1508,362 @@ static int sweep_one(obj_t *block)
     block->t.next = free_list;
     free_list = block;
   }
+}
 
-  return 1;
+/*
+ * Free the objects of the heap whose bits are set in dead, which
+ * covers the bitmap word w.
+ */
+static void sweep_word(heap_t *heap, cnum w, unsigned long dead)
+{
+  obj_t *block = heap->block + w * MARK_BITS;
+
+  heap->h.alloc[w] &= ~dead;
+
+  while (dead != 0) {
+    while ((dead & 0xff) == 0) {
+      dead >>= 8;
+      block += 8;
+    }
+    if (dead & 1)
+      sweep_one(block);
+    dead >>= 1;
+    block++;
+  }
 }
 
-static int_ptr_t sweep(void)
+#if CONFIG_GEN_GC
+
+/*
+ * Minor collection: only the objects in fresh and remembered cards can
+ * be young. Older objects sharing those cards are skipped. In a full
+ * collection, the young survivors in those same cards are promoted.
+ */
+static void sweep_cards(heap_t *heap)
 {
-  int_ptr_t free_count = 0;
-  heap_t *heap;
-#ifdef HAVE_VALGRIND
-  const int vg_dbg = opt_vg_debug;
+  cnum c;
+
+  for (c = 0; c < CARDS_PER_HEAP; c++) {
+    unsigned int bit = 1U << (c % CARD_CELL_BITS);
+    cnum cell = c / CARD_CELL_BITS;
+
+    if ((heap->h.fresh_cards[cell] | heap->h.rem_cards[cell]) & bit) {
+      cnum j = c * CARD_SIZE, end = j + CARD_SIZE;
+
+      if (end > (cnum) HEAP_CELLS)
+        end = HEAP_CELLS;
+
+      for (; j < end; j++) {
+        unsigned long mask = 1UL << (j % MARK_BITS);
+        obj_t *block = &heap->block[j];
+
+        if ((heap->h.alloc[j / MARK_BITS] & mask) == 0 || block->t.gen > 0)
+          continue;
+
+        if (heap->h.marks[j / MARK_BITS] & mask) {
+          block->t.gen = 1;
+        } else if (!full_gc) {
+          heap->h.alloc[j / MARK_BITS] &= ~mask;
+          sweep_one(block);
+        }
+      }
+    }
+  }
+}
+
 #endif
 
+static void sweep_heap(heap_t *heap)
+{
+  cnum w;
+
   if (free_list == 0)
     free_tail = &free_list;
 
+  /* Words whose objects are all live or all free are passed over
+     without touching the objects. */
+  for (w = 0; w < (cnum) MARK_CELLS; w++) {
+    unsigned long dead = heap->h.alloc[w] & ~heap->h.marks[w];
+    heap->h.marks[w] = 0;
+    if (dead != 0)
+      sweep_word(heap, w, dead);
+  }
+
+  heap->h.pending = 0;
+}
+
+/*
+ * A full collection only marks; the heaps are then swept one at a
+ * time as make_obj runs out of free cells. Returns true if this
+ * produced some free cells.
+ */
+static int sweep_lazily(void)
+{
+  cnum start;
+
+  if (sweep_pending == 0)
+    return free_list != 0;
+
+  start = usec_now();
+
+  while (free_list == 0 && sweep_pending != 0) {
+    heap_t *heap = sweep_pending;
+    sweep_pending = heap->h.next;
+    sweep_heap(heap);
+  }
+
+  stat_sweep_usec += usec_now() - start;
+  return free_list != 0;
+}
+
+static void sweep_finish(void)
+{
+  cnum start;
+
+  if (sweep_pending == 0)
+    return;
+
+  start = usec_now();
+
+  while (sweep_pending != 0) {
+    heap_t *heap = sweep_pending;
+    sweep_pending = heap->h.next;
+    sweep_heap(heap);
+  }
+
+  stat_sweep_usec += usec_now() - start;
+}
+
+/*
+ * Returns the number of free object cells in all heaps, or
+ * how many there will be once the pending sweep is done.
+ */
+static int_ptr_t sweep(void)
+{
+  heap_t *heap;
+
 #if CONFIG_GEN_GC
   if (!full_gc) {
-    int i;
-    /* No need to mark block defined via Valgrind API; everything
-       in the freshobj is an allocated node! */
-    for (i = 0; i < freshobj_idx; i++)
-      free_count += sweep_one(freshobj[i]);
+    cnum i;
+
+    if (free_list == 0)
+      free_tail = &free_list;
+
+    for (i = 0; i < heap_count; i++) {
+      heap = heap_index[i];
 
-    return free_count;
+      if (!heap->h.dirty)
+        continue;
+
+      sweep_cards(heap);
+      memset(heap->h.marks, 0, sizeof heap->h.marks);
+    }
+
+    return heap_count * HEAP_CELLS - alloc_count;
   }
 #endif
 
-  for (heap = heap_list; heap != 0; heap = heap->next) {
-    obj_t *block, *end;
+  for (heap = heap_list; heap != 0; heap = heap->h.next) {
+#if CONFIG_GEN_GC
+    if (heap->h.dirty)
+      sweep_cards(heap);
+#endif
+    heap->h.pending = 1;
+  }
+
+  sweep_pending = heap_list;
+
+  return heap_count * HEAP_CELLS - live_count;
+}
+
+/*
+ * Find heaps in which nothing was marked, and give them back to the
+ * system, as long as enough heaps remain to meet the heap target.
+ * The objects in them are finalized, and the cells of theirs which
+ * are on the free list are taken out of it.
+ */
+static void release_heaps(void)
+{
+  cnum i, j, total = heap_count * HEAP_CELLS;
+  heap_t **pheap;
+  val *pcell;
+  int count = 0;
+
+  for (i = 0; i < heap_count && total - (cnum) HEAP_CELLS >= heap_target; i++) {
+    heap_t *heap = heap_index[i];
+    cnum w;
+
+    for (w = 0; w < (cnum) MARK_CELLS; w++)
+      if (heap->h.marks[w] != 0)
+        break;
+
+    if (w < (cnum) MARK_CELLS)
+      continue;
+
+    for (w = 0; w < (cnum) MARK_CELLS; w++) {
+      unsigned long dead = heap->h.alloc[w];
+      obj_t *block = heap->block + w * MARK_BITS;
+
+      for (; dead != 0; dead >>= 1, block++) {
+        if (dead & 1) {
+          finalize(block);
+          alloc_count--;
+          stat_swept++;
+        }
+      }
+    }
+
+    heap->h.release = 1;
+    total -= HEAP_CELLS;
+    count++;
+  }
 
+  if (count == 0)
+    return;
+
+  stat_release += count;
+
+  for (pcell = &free_list; *pcell != 0; ) {
+    val cell = *pcell;
 #ifdef HAVE_VALGRIND
-    if (vg_dbg)
-        VALGRIND_MAKE_MEM_DEFINED(&heap->block, sizeof heap->block);
+    if (opt_vg_debug)
+      VALGRIND_MAKE_MEM_DEFINED(cell, sizeof *cell);
+#endif
+    if (heap_of(cell)->h.release) {
+      *pcell = cell->t.next;
+    } else {
+      pcell = &cell->t.next;
+#ifdef HAVE_VALGRIND
+      if (opt_vg_debug)
+        VALGRIND_MAKE_MEM_NOACCESS(cell, sizeof *cell);
 #endif
-
-    for (block = heap->block, end = heap->block + HEAP_SIZE;
-         block < end;
-         block++)
-    {
-      free_count += sweep_one(block);
     }
   }
 
-  return free_count;
+  free_tail = pcell;
+
+  for (pheap = &heap_list; *pheap != 0; ) {
+    heap_t *heap = *pheap;
+    if (heap->h.release)
+      *pheap = heap->h.next;
+    else
+      pheap = &heap->h.next;
+  }
+
+  for (i = j = 0; i < heap_count; i++) {
+    heap_t *heap = heap_index[i];
+    if (heap->h.release)
+      heap_free(heap);
+    else
+      heap_index[j++] = heap;
+  }
+
+  heap_count = j;
+
+  if (heap_count > 0) {
+    heap_min_bound = heap_index[0]->block;
+    heap_max_bound = heap_index[heap_count - 1]->block + HEAP_CELLS;
+  } else {
+    heap_min_bound = heap_max_bound = 0;
+  }
+}
+
+/*
+ * After the marking phase of a full collection, set the heap target
+ * from the live count. Then grow the heap to meet it, or else release
+ * surplus heaps which contain nothing live.
+ */
+static void heap_policy(void)
+{
+  cnum total = heap_count * HEAP_CELLS;
+
+  heap_target = live_count / gc_live_percent * 100;
+
+  if (heap_target < live_count + gc_min_free)
+    heap_target = live_count + gc_min_free;
+
+  if (heap_target < gc_min_heaps * (cnum) HEAP_CELLS)
+    heap_target = gc_min_heaps * HEAP_CELLS;
+
+  if (total >= heap_target) {
+    release_heaps();
+    return;
+  }
+
+  for (; total < heap_target; total += HEAP_CELLS)
+    more();
+}
+
+static void gc_pause(cnum usec)
+{
+  cnum limit = PAUSE_MIN_USEC;
+  int i;
+
+  for (i = 0; i < PAUSE_BUCKETS - 1 && usec >= limit; i++)
+    limit *= 2;
+
+  stat_pause_hist[i]++;
+  stat_pause_usec += usec;
+  if (usec > stat_pause_max)
+    stat_pause_max = usec;
 }
 
 void gc(void)
 {
   val gc_stack_top = nil;
-#if CONFIG_GEN_GC
-  int exhausted = (free_list == 0);
-#endif
 
   if (gc_enabled) {
-    int swept;
+    mach_context_t mc;
+    cnum start = usec_now(), mark_end;
 #if CONFIG_GEN_GC
+    int swept, exhausted;
     static int gc_counter;
-    if (++gc_counter >= FULL_GC_INTERVAL) {
+#endif
+
+    sweep_finish();
+    arena_trim();
+
+#if CONFIG_GEN_GC
+    exhausted = (free_list == 0);
+    if (++gc_counter >= gc_full_interval) {
       full_gc = 1;
       gc_counter = 0;
     }
 #endif
 
-    mach_context_t mc;
     save_context(mc);
     gc_enabled = 0;
+    live_count = 0;
     mark(&mc, &gc_stack_top);
     hash_process_weak();
-    swept = sweep();
+    mark_end = usec_now();
+    stat_mark_usec += mark_end - start;
 #if CONFIG_GEN_GC
-#if 0
-    printf("sweep: freed %d full_gc == %d exhausted == %d\n",
-           (int) swept, full_gc, exhausted);
-#endif
-    if (full_gc && swept < 3 * HEAP_SIZE / 4)
-      more();
-    else if (!full_gc && swept < HEAP_SIZE / 4 && exhausted)
+    if (full_gc) {
+      stat_full++;
+      heap_policy();
+    } else {
+      stat_minor++;
+    }
+    swept = sweep();
+    if (!full_gc && swept < gc_minor_min_free && exhausted)
       more();
 #else
-    if (swept < 3 * HEAP_SIZE / 4)
-      more();
+    stat_full++;
+    heap_policy();
+    sweep();
 #endif
 
 #if CONFIG_GEN_GC
-    checkobj_idx = 0;
-    freshobj_idx = 0;
+    cards_clear();
+    fresh_count = 0;
     full_gc = 0;
 #endif
+    {
+      cnum end = usec_now();
+      stat_sweep_usec += end - mark_end;
+      gc_pause(end - start);
+    }
     gc_enabled = 1;
   }
 }
@@ -584,9 +1875,69 @@ int gc_state(int enabled)
   return old;
 }
 
+/*
+ * Lisp interfaces to the above. An explicit collection is always
+ * a full one.
+ */
+val gc_collect(void)
+{
+  if (!gc_enabled)
+    return nil;
+#if CONFIG_GEN_GC
+  full_gc = 1;
+#endif
+  gc();
+  return t;
+}
+
+val gc_set_state(val enabled)
+{
+  return gc_state(enabled != nil) ? t : nil;
+}
+
+static struct gc_param *gc_param_find(val key, val self)
+{
+  struct gc_param *p;
+
+  for (p = gc_params; p->name != 0; p++)
+    if (intern(string_utf8(p->name), keyword_package) == key)
+      return p;
+
+  uw_throwf(error_s, lit("~a: unknown parameter ~s"), self, key, nao);
+}
+
+val gc_get_params(void)
+{
+  struct gc_param *p;
+  list_collect_decl (out, ptail);
+
+  for (p = gc_params; p->name != 0; p++)
+    list_collect(ptail, cons(intern(string_utf8(p->name), keyword_package),
+                             num(*p->var)));
+
+  return out;
+}
+
+val gc_set_param(val key, val value)
+{
+  val self = lit("set-gc-param");
+  struct gc_param *p = gc_param_find(key, self);
+  cnum old = *p->var;
+
+  if (!integerp(value) || lt(value, num(p->min)) || gt(value, num(p->max)))
+    uw_throwf(error_s, lit("~a: ~s needs an integer from ~a to ~a, not ~s"),
+              self, key, num(p->min), num(p->max), value, nao);
+
+  *p->var = c_num(value);
+  return num(old);
+}
+
 void gc_init(val *stack_bottom)
 {
+  assert (sizeof (heap_t) <= HEAP_BYTES);
+  assert ((HEAP_BYTES & (HEAP_BYTES - 1)) == 0);
   gc_stack_bottom = stack_bottom;
+  stack_grows_down = (val *) &stack_bottom < stack_bottom;
 }
 
 void gc_mark(val obj)
@@ -594,9 +1945,70 @@ void gc_mark(val obj)
   mark_obj(obj);
 }
 
+val gc_scan_time(void)
+{
+  return num(stack_scan_usec);
+}
+
+val gc_stats(void)
+{
+  val hist = nil;
+  cnum limit = PAUSE_MIN_USEC;
+  int i;
+
+  for (i = 0; i < PAUSE_BUCKETS; i++, limit *= 2)
+    hist = cons(cons(if2(i < PAUSE_BUCKETS - 1, num(limit)),
+                     num(stat_pause_hist[i])), hist);
+
+  return list(cons(intern(lit("minor"), keyword_package), num(stat_minor)),
+              cons(intern(lit("full"), keyword_package), num(stat_full)),
+              cons(intern(lit("mark-usec"), keyword_package),
+                   num(stat_mark_usec)),
+              cons(intern(lit("sweep-usec"), keyword_package),
+                   num(stat_sweep_usec)),
+              cons(intern(lit("pause-usec"), keyword_package),
+                   num(stat_pause_usec)),
+              cons(intern(lit("pause-max-usec"), keyword_package),
+                   num(stat_pause_max)),
+              cons(intern(lit("swept"), keyword_package), num(stat_swept)),
+              cons(intern(lit("heaps"), keyword_package), num(heap_count)),
+              cons(intern(lit("heap-grow"), keyword_package),
+                   num(stat_grow)),
+              cons(intern(lit("heap-release"), keyword_package),
+                   num(stat_release)),
+              cons(intern(lit("pause-histogram"), keyword_package),
+                   nreverse(hist)),
+              nao);
+}
+
+void gc_stats_print(val out)
+{
+  cnum limit = PAUSE_MIN_USEC;
+  int i;
+
+  format(out, lit("gc: ~a collections (~a full, ~a minor)\n"),
+         num(stat_full + stat_minor), num(stat_full), num(stat_minor), nao);
+  format(out, lit("gc: mark ~a usec, sweep ~a usec, ~a objects freed\n"),
+         num(stat_mark_usec), num(stat_sweep_usec), num(stat_swept), nao);
+  format(out, lit("gc: ~a heaps, ~a added, ~a released\n"),
+         num(heap_count), num(stat_grow), num(stat_release), nao);
+  format(out, lit("gc: pauses total ~a usec, max ~a usec\n"),
+         num(stat_pause_usec), num(stat_pause_max), nao);
+
+  for (i = 0; i < PAUSE_BUCKETS - 1; i++, limit *= 2)
+    if (stat_pause_hist[i])
+      format(out, lit("gc:   < ~8a usec: ~a\n"),
+             num(limit), num(stat_pause_hist[i]), nao);
+
+  if (stat_pause_hist[i])
+    format(out, lit("gc:  >= ~8a usec: ~a\n"),
+           num(limit / 2), num(stat_pause_hist[i]), nao);
+}
+
 int gc_is_reachable(val obj)
 {
-  type_t t;
+  heap_t *heap;
+  cnum i;
 
   if (!is_ptr(obj))
     return 1;
@@ -606,20 +2018,30 @@ int gc_is_reachable(val obj)
     return 1;
 #endif
 
-  t = obj->t.type;
+  heap = heap_of(obj);
+  i = obj - heap->block;
 
-  return (t & REACHABLE) != 0;
+  return (heap->h.marks[i / MARK_BITS] & (1UL << (i % MARK_BITS))) != 0;
 }
 
 #if CONFIG_GEN_GC
 
+/*
+ * A place inside a heap, or in malloced memory, belongs to some object,
+ * which may be old; places elsewhere, such as on the stack, are roots.
+ * Heaps are not in the malloc range if they are mapped.
+ */
+static int in_object_range(val *ptr)
+{
+  return in_malloc_range((mem_t *) ptr) ||
+         ((obj_t *) ptr >= heap_min_bound && (obj_t *) ptr < heap_max_bound);
+}
+
 val gc_set(val *ptr, val obj)
 {
-  if (in_malloc_range((mem_t *) ptr) && is_ptr(obj) && obj->t.gen == 0) {
-    if (checkobj_idx >= CHECKOBJ_VEC_SIZE)
-      gc();
+  if (in_object_range(ptr) && is_ptr(obj) && obj->t.gen == 0) {
     obj->t.gen = -1;
-    checkobj[checkobj_idx++] = obj;
+    card_set_rem(obj);
   }
   *ptr = obj;
   return obj;
@@ -627,10 +2049,11 @@ val gc_set(val *ptr, val obj)
 
 val gc_mutated(val obj)
 {
-  if (checkobj_idx >= CHECKOBJ_VEC_SIZE)
-    gc();
-  obj->t.gen = -1;
-  return checkobj[checkobj_idx++] = obj;
+  if (obj->t.gen != -1) {
+    obj->t.gen = -1;
+    card_set_rem(obj);
+  }
+  return obj;
 }
 
 val gc_push(val obj, val *plist)
@@ -647,15 +2070,8 @@ void unmark(void)
 {
   heap_t *heap;
 
-  for (heap = heap_list; heap != 0; heap = heap->next) {
-    val block, end;
-    for (block = heap->block, end = heap->block + HEAP_SIZE;
-         block < end;
-         block++)
-    {
-      block->t.type = (type_t) (block->t.type & ~(FREE | REACHABLE));
-    }
-  }
+  for (heap = heap_list; heap != 0; heap = heap->h.next)
+    memset(heap->h.marks, 0, sizeof heap->h.marks);
 }
 
 void dheap(heap_t *heap, int start, int end);
@@ -24,16 +24,51 @@
  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
  */
 
+struct gc_param {
+  const char *name;
+  cnum *var;
+  cnum min, max;
+};
+
+extern cnum gc_live_percent, gc_min_free, gc_min_heaps;
+#if CONFIG_GEN_GC
+extern cnum gc_nursery_size, gc_full_interval, gc_minor_min_free;
+#endif
+extern struct gc_param gc_params[];
+extern cnum gc_clear_stack;
+
+#define GC_FRAME_ROOTS 8
+
+typedef struct gc_frame {
+  struct gc_frame *up;
+  cnum gcs;
+  int nroots;
+  val *root[GC_FRAME_ROOTS];
+} gc_frame_t;
+
 void gc_init(val *stack_bottom);
 val prot1(val *loc);
 void rel1(val *loc);
 void protect(val *, ...);
 void release(val *, ...);
+void gc_frame_begin(gc_frame_t *, ...);
+void gc_frame_end(gc_frame_t *);
+void gc_frame_unwind(mem_t *exit_point);
 val make_obj(void);
+mem_t *gc_payload_alloc(size_t size);
+mem_t *gc_payload_realloc(mem_t *old, size_t size);
+void gc_payload_free(mem_t *ptr);
 void gc(void);
 int gc_state(int);
+val gc_collect(void);
+val gc_set_state(val enabled);
+val gc_get_params(void);
+val gc_set_param(val key, val value);
 void gc_mark(val);
 int gc_is_reachable(val);
+val gc_scan_time(void);
+val gc_stats(void);
+void gc_stats_print(val out);
 
 #if CONFIG_GEN_GC
 val gc_set(val *, val);
@@ -45,5 +80,4 @@ void unmark(void);
 void gc_hint_func(val *);
 
 #define gc_hint(var) gc_hint_func(&var)
-#define REACHABLE 0x100
 #define FREE      0x200
@@ -78,6 +78,12 @@ static struct hash *reachable_weak_hashes;
 static val last_equal_key;
 static cnum last_equal_hash = NUM_MAX;
 
+/*
+ * Table of interned strings: weak in both key and value, which are
+ * the same string.
+ */
+static val str_intern_hash;
+
 /*
  * This is is an adaptation of hashpjw, from Compilers: Principles, Techniques
  * and Tools, Aho, Sethi, Ulman, 1988. P. 436.  The register is wider by
@@ -85,18 +91,48 @@ static cnum last_equal_hash = NUM_MAX;
  * We don't reduce the final result modulo a small prime, but leave it
  * as it is; let the hashing routines do their own reduction.
  */
+static unsigned long hash_step(unsigned long h, wchar_t ch)
+{
+  unsigned long g;
+  h = (h << 4) + ch;
+  g = h & 0x7C000000;
+  return h ^ (g >> 26) ^ g;
+}
+
 static unsigned long hash_c_str(const wchar_t *str)
 {
   unsigned long h = 0;
-  while (*str) {
-    unsigned long g;
-    h = (h << 4) + *str++;
-    g = h & 0x7C000000;
-    h = h ^ (g >> 26) ^ g;
-  }
+  while (*str)
+    h = hash_step(h, *str++);
   return h;
 }
 
+/*
+ * Strings cache their hash code; the functions which modify a string
+ * invalidate it. The mask keeps the hash, plus one, within the unsigned
+ * field of the string.
+ */
+#define STR_HASH_MASK (NUM_MAX & 0x7FFFFFFF)
+
+static cnum str_hash(val str)
+{
+  if (str->st.hash == 0) {
+    unsigned long h = 0;
+
+    if (is_narrow_str(str)) {
+      const unsigned char *p = narrow_ptr(str);
+      while (*p)
+        h = hash_step(h, *p++);
+    } else {
+      h = hash_c_str(str->st.str);
+    }
+
+    str->st.hash = (h & STR_HASH_MASK) + 1;
+  }
+
+  return str->st.hash - 1;
+}
+
 static cnum hash_double(double n)
 {
 #ifdef HAVE_UINTPTR_T
@@ -117,38 +153,31 @@ static cnum hash_double(double n)
 
 static cnum equal_hash(val obj)
 {
-  if (obj == last_equal_key)
-    return last_equal_hash;
-
-  last_equal_key = obj;
-
   switch (type(obj)) {
   case NIL:
-    return last_equal_hash = NUM_MAX;
+    return NUM_MAX;
   case LIT:
-    return last_equal_hash = hash_c_str(litptr(obj)) & NUM_MAX;
+    return hash_c_str(litptr(obj)) & STR_HASH_MASK;
   case CONS:
-    return last_equal_hash = (equal_hash(obj->c.car) +
-                              equal_hash(obj->c.cdr)) & NUM_MAX;
+    return (equal_hash(obj->c.car) + equal_hash(obj->c.cdr)) & NUM_MAX;
   case STR:
-    return last_equal_hash = hash_c_str(obj->st.str) & NUM_MAX;
+    return str_hash(obj);
   case CHR:
-    return last_equal_hash = c_chr(obj) & NUM_MAX;
+    return c_chr(obj) & NUM_MAX;
   case NUM:
-    return last_equal_hash = c_num(obj) & NUM_MAX;
+    return c_num(obj) & NUM_MAX;
   case SYM:
   case PKG:
   case ENV:
     switch (sizeof (mem_t *)) {
     case 4:
-      return last_equal_hash = (((cnum) obj) >> 4) & NUM_MAX;
+      return (((cnum) obj) >> 4) & NUM_MAX;
     case 8: default:
-      return last_equal_hash = (((cnum) obj) >> 5) & NUM_MAX;
+      return (((cnum) obj) >> 5) & NUM_MAX;
     }
     break;
   case FUN:
-    return last_equal_hash = ((cnum) obj->f.f.interp_fun +
-                              equal_hash(obj->f.env)) & NUM_MAX;
+    return ((cnum) obj->f.f.interp_fun + equal_hash(obj->f.env)) & NUM_MAX;
   case VEC:
     {
       val length = obj->v.vec[vec_length];
@@ -158,7 +187,7 @@ static cnum equal_hash(val obj)
       for (i = 0; i < len; i++)
         h = (h + equal_hash(obj->v.vec[i])) & NUM_MAX;
 
-      return last_equal_hash = h;
+      return h;
     }
   case LCONS:
     return (equal_hash(car(obj)) + equal_hash(cdr(obj))) & NUM_MAX;
@@ -166,11 +195,17 @@ static cnum equal_hash(val obj)
     lazy_str_force(obj);
     return equal_hash(obj->ls.prefix);
   case BGNUM:
+    if (obj == last_equal_key)
+      return last_equal_hash;
+    last_equal_key = obj;
     return last_equal_hash = mp_hash(mp(obj)) & NUM_MAX;
   case FLNUM:
+    if (obj == last_equal_key)
+      return last_equal_hash;
+    last_equal_key = obj;
     return last_equal_hash = hash_double(obj->fl.n);
   case COBJ:
-    return last_equal_hash = obj->co.ops->hash(obj) & NUM_MAX;
+    return obj->co.ops->hash(obj) & NUM_MAX;
   }
 
   internal_error("unhandled case in equal function");
@@ -186,10 +221,12 @@ static cnum eql_hash(val obj)
     case BGNUM:
       if (obj == last_equal_key)
         return last_equal_hash;
+      last_equal_key = obj;
       return last_equal_hash = mp_hash(mp(obj)) & NUM_MAX;
     case FLNUM:
       if (obj == last_equal_key)
         return last_equal_hash;
+      last_equal_key = obj;
       return last_equal_hash = hash_double(obj->fl.n);
     default:
       switch (sizeof (mem_t *)) {
@@ -311,6 +348,8 @@ static void hash_mark(val hash)
     break;
   case hash_weak_both:
     /* Values and keys are weak: don't mark anything. */
+    h->next = reachable_weak_hashes;
+    reachable_weak_hashes = h;
     break;
   }
 }
@@ -706,9 +745,36 @@ val hash_alist(val hash)
   return make_half_lazy_cons(func_f1(iter, hash_alist_lazy), cell);
 }
 
+/*
+ * Return a string equal to str, which is the same object for all
+ * equal strings passed to this function, as long as that object remains
+ * reachable. The object is a copy of the first such string, marked
+ * so that the functions which modify strings refuse to change it.
+ */
+val intern_str(val str)
+{
+  val found;
+
+  if (type(str) != STR)
+    return str;
+
+  found = gethash(str_intern_hash, str);
+
+  if (!found) {
+    found = copy_str(str);
+    found->st.interned = 1;
+    sethash(str_intern_hash, found, found);
+  }
+
+  return found;
+}
+
 void hash_init(void)
 {
   weak_keys_k = intern(lit("weak-keys"), keyword_package);
   weak_vals_k = intern(lit("weak-vals"), keyword_package);
   equal_based_k = intern(lit("equal-based"), keyword_package);
+
+  prot1(&str_intern_hash);
+  str_intern_hash = make_hash(t, t, t);
 }
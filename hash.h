@@ -49,6 +49,7 @@ val hash_keys(val hash);
 val hash_values(val hash);
 val hash_pairs(val hash);
 val hash_alist(val hash);
+val intern_str(val str);
 
 void hash_process_weak(void);
 
@@ -907,6 +907,8 @@ val eql(val left, val right)
   return eq(left, right);
 }
 
+static val str_equal(val left, val right);
+
 val equal(val left, val right)
 {
   if (left == right)
@@ -931,7 +933,7 @@ val equal(val left, val right)
     case LIT:
       return wcscmp(litptr(left), litptr(right)) == 0 ? t : nil;
     case STR:
-      return wcscmp(litptr(left), right->st.str) == 0 ? t : nil;
+      return str_equal(left, right);
     case LSTR:
       lazy_str_force(right);
       return equal(left, right->ls.prefix);
@@ -942,9 +944,8 @@ val equal(val left, val right)
   case STR:
     switch (type(right)) {
     case LIT:
-      return wcscmp(left->st.str, litptr(right)) == 0 ? t : nil;
     case STR:
-      return wcscmp(left->st.str, right->st.str) == 0 ? t : nil;
+      return str_equal(left, right);
     case LSTR:
       lazy_str_force(right);
       return equal(left, right->ls.prefix);
@@ -1439,10 +1440,40 @@ val exptv(val nlist)
   return reduce_right(func_n2(expt), nlist, one, nil);
 }
 
+static void str_init_flags(val str)
+{
+  str->st.hash = 0;
+  str->st.interned = 0;
+  str->st.narrow = 0;
+  str->st.watched = 0;
+}
+
+static val str_wide_hash;
+static cnum str_watch_count;
+
+/*
+ * Called by the functions which modify a string in place. Strings
+ * returned by intern_str are shared, and filed in the table of interned
+ * strings under their hash, so they must not change. Modifying a watched
+ * string tells the cache of string tree automata to check its trees again.
+ */
+static void str_modify(val str, val self)
+{
+  if (str->st.interned)
+    uw_throwf(error_s, lit("~a: interned string ~s cannot be modified"),
+              self, str, nao);
+  str_hash_invalidate(str);
+  if (is_narrow_str(str))
+    remhash(str_wide_hash, str);
+  if (str->st.watched)
+    str_watch_count++;
+}
+
 val string_own(wchar_t *str)
 {
   val obj = make_obj();
   obj->st.type = STR;
+  str_init_flags(obj);
   obj->st.str = str;
   obj->st.len = nil;
   obj->st.alloc = nil;
@@ -1451,9 +1482,12 @@ val string_own(wchar_t *str)
 
 val string(const wchar_t *str)
 {
+  size_t nchar = wcslen(str) + 1;
   val obj = make_obj();
   obj->st.type = STR;
-  obj->st.str = (wchar_t *) chk_strdup(str);
+  str_init_flags(obj);
+  obj->st.str = (wchar_t *) gc_payload_alloc(nchar * sizeof (wchar_t));
+  wmemcpy(obj->st.str, str, nchar);
   obj->st.len = nil;
   obj->st.alloc = nil;
   return obj;
@@ -1463,16 +1497,124 @@ val string_utf8(const char *str)
 {
   val obj = make_obj();
   obj->st.type = STR;
+  str_init_flags(obj);
   obj->st.str = utf8_dup_from(str);
   obj->st.len = nil;
   obj->st.alloc = nil;
   return obj;
 }
 
+/*
+ * A narrow string stores characters in the range 1 to 255 in one byte each,
+ * which saves memory for text that is mostly ASCII or Latin-1. Its length is
+ * always known, and its narrow flag is set. The byte array stays in place
+ * until the string is modified: when a wchar_t array is needed, c_str makes
+ * a wide copy, which is kept in str_wide_hash for as long as the string
+ * lives. A function which modifies the string widens it in place.
+ */
+static val narrow_string(const unsigned char *src, cnum len)
+{
+  unsigned char *str = (unsigned char *) gc_payload_alloc(len + 1);
+  val obj;
+  /* src may point into another string, which make_obj could reclaim. */
+  memcpy(str, src, len);
+  str[len] = 0;
+  obj = make_obj();
+  obj->st.type = STR;
+  str_init_flags(obj);
+  obj->st.str = (wchar_t *) str;
+  obj->st.len = num(len);
+  obj->st.alloc = num(len + 1);
+  obj->st.narrow = 1;
+  return obj;
+}
+
+val string_compact(const wchar_t *str, cnum len)
+{
+  cnum i;
+
+  for (i = 0; i < len; i++)
+    if (str[i] == 0 || str[i] > 255)
+      break;
+
+  if (i < len) {
+    wchar_t *wide = (wchar_t *) gc_payload_alloc((len + 1) * sizeof *wide);
+    wmemcpy(wide, str, len);
+    wide[len] = 0;
+    return string_own(wide);
+  } else {
+    val obj = make_obj();
+    unsigned char *narrow = (unsigned char *) gc_payload_alloc(len + 1);
+    for (i = 0; i <= len; i++)
+      narrow[i] = str[i];
+    obj->st.type = STR;
+    str_init_flags(obj);
+    obj->st.str = (wchar_t *) narrow;
+    obj->st.len = num(len);
+    obj->st.alloc = num(len + 1);
+    obj->st.narrow = 1;
+    return obj;
+  }
+}
+
+static void str_widen(val str)
+{
+  cnum len = c_num(str->st.len), i;
+  unsigned char *narrow = narrow_ptr(str);
+  wchar_t *wide = (wchar_t *) gc_payload_alloc((len + 1) * sizeof *wide);
+
+  for (i = 0; i <= len; i++)
+    wide[i] = narrow[i];
+
+  str->st.str = wide;
+  str->st.narrow = 0;
+  gc_payload_free(narrow);
+}
+
+/*
+ * Character of a literal or ordinary string, without widening it.
+ */
+static wchar_t str_ref(val str, cnum index)
+{
+  if (is_narrow_str(str))
+    return narrow_ptr(str)[index];
+  return c_str(str)[index];
+}
+
+static int narrow_eq(const unsigned char *narrow, const wchar_t *wide, cnum len)
+{
+  cnum i;
+
+  for (i = 0; i < len; i++)
+    if (narrow[i] != wide[i])
+      return 0;
+
+  return 1;
+}
+
+static val str_equal(val left, val right)
+{
+  int lnarrow = is_narrow_str(left);
+  int rnarrow = is_narrow_str(right);
+
+  if (lnarrow && rnarrow) {
+    return c_true(left->st.len == right->st.len &&
+                  memcmp(narrow_ptr(left), narrow_ptr(right),
+                         c_num(left->st.len)) == 0);
+  } else if (lnarrow || rnarrow) {
+    val narrow = lnarrow ? left : right;
+    const wchar_t *wide = c_str(lnarrow ? right : left);
+    cnum len = c_num(narrow->st.len);
+    return c_true(narrow_eq(narrow_ptr(narrow), wide, len) && wide[len] == 0);
+  }
+
+  return c_true(wcscmp(c_str(left), c_str(right)) == 0);
+}
+
 val mkstring(val len, val ch)
 {
   size_t nchar = c_num(len) + 1;
-  wchar_t *str = (wchar_t *) chk_malloc(nchar * sizeof *str);
+  wchar_t *str = (wchar_t *) gc_payload_alloc(nchar * sizeof *str);
   val s = string_own(str);
   wmemset(str, c_chr(ch), nchar);
   s->st.len = len;
@@ -1483,7 +1625,7 @@ val mkstring(val len, val ch)
 val mkustring(val len)
 {
   cnum l = c_num(len);
-  wchar_t *str = (wchar_t *) chk_malloc((l + 1) * sizeof *str);
+  wchar_t *str = (wchar_t *) gc_payload_alloc((l + 1) * sizeof *str);
   val s = string_own(str);
   str[l] = 0;
   s->st.len = len;
@@ -1494,18 +1636,21 @@ val mkustring(val len)
 val init_str(val str, const wchar_t *data)
 {
   wmemcpy(str->st.str, data, c_num(str->st.len));
+  str_hash_invalidate(str);
   return str;
 }
 
 val copy_str(val str)
 {
+  if (is_narrow_str(str))
+    return narrow_string(narrow_ptr(str), c_num(str->st.len));
   return string(c_str(str));
 }
 
 val upcase_str(val str)
 {
   val len = length_str(str);
-  wchar_t *dst = (wchar_t *) chk_malloc((c_num(len) + 1) * sizeof *dst);
+  wchar_t *dst = (wchar_t *) gc_payload_alloc((c_num(len) + 1) * sizeof *dst);
   const wchar_t *src = c_str(str);
   val out = string_own(dst);
 
@@ -1518,7 +1663,7 @@ val upcase_str(val str)
 val downcase_str(val str)
 {
   val len = length_str(str);
-  wchar_t *dst = (wchar_t *) chk_malloc((c_num(len) + 1) * sizeof *dst);
+  wchar_t *dst = (wchar_t *) gc_payload_alloc((c_num(len) + 1) * sizeof *dst);
   const wchar_t *src = c_str(str);
   val out = string_own(dst);
 
@@ -1531,6 +1676,12 @@ val downcase_str(val str)
 val string_extend(val str, val tail)
 {
   type_check(str, STR);
+
+  str_modify(str, lit("string_extend"));
+
+  if (is_narrow_str(str))
+    str_widen(str);
+
   {
     cnum len = c_num(length_str(str));
     cnum alloc = c_num(str->st.alloc);
@@ -1560,8 +1711,8 @@ val string_extend(val str, val tail)
     if (gt(needed, room))
       uw_throwf(error_s, lit("string_extend: overflow"), nao);
 
-    str->st.str = (wchar_t *) chk_realloc((mem_t *) str->st.str,
-                                          alloc * sizeof *str->st.str);
+    str->st.str = (wchar_t *) gc_payload_realloc((mem_t *) str->st.str,
+                                                 alloc * sizeof *str->st.str);
     set(str->st.alloc, num(alloc));
     set(str->st.len, plus(str->st.len, needed));
 
@@ -1622,6 +1773,19 @@ const wchar_t *c_str(val obj)
 
   switch (obj->t.type) {
   case STR:
+    if (is_narrow_str(obj)) {
+      val wide = gethash(str_wide_hash, obj);
+      if (!wide) {
+        cnum len = c_num(obj->st.len), i;
+        const unsigned char *narrow = narrow_ptr(obj);
+        wchar_t *str = (wchar_t *) gc_payload_alloc((len + 1) * sizeof *str);
+        for (i = 0; i <= len; i++)
+          str[i] = narrow[i];
+        wide = string_own(str);
+        sethash(str_wide_hash, obj, wide);
+      }
+      return wide->st.str;
+    }
     return obj->st.str;
   case SYM:
     return c_str(symbol_name(obj));
@@ -1633,6 +1797,94 @@ const wchar_t *c_str(val obj)
   }
 }
 
+/*
+ * Skip tables for Boyer-Moore-Horspool searching, indexed by the low bits of
+ * the character. Characters which share their low bits share a table entry,
+ * which holds the smallest of their shifts, so that a shift never skips over
+ * a match. The tables are kept in a weak hash keyed on the needle string,
+ * so they are not recomputed each time the same needle is searched for.
+ * A copy of the needle is kept also, to detect that the string was modified.
+ */
+#define SEARCH_SKIP_SIZE 256
+#define SEARCH_SKIP(ch) ((unsigned) (ch) % SEARCH_SKIP_SIZE)
+
+struct search_table {
+  cnum len;
+  wchar_t *needle;
+  cnum fwd[SEARCH_SKIP_SIZE];   /* shift by last character of window */
+  cnum rev[SEARCH_SKIP_SIZE];   /* shift back by first character of window */
+};
+
+static val search_table_s;
+static val search_table_hash;
+
+static void search_table_destroy(val obj)
+{
+  struct search_table *st = (struct search_table *) obj->co.handle;
+  free(st->needle);
+  free(st);
+  obj->co.handle = 0;
+}
+
+static struct cobj_ops search_table_ops = {
+  cobj_equal_op,
+  cobj_print_op,
+  search_table_destroy,
+  cobj_mark_op,
+  cobj_hash_op
+};
+
+static struct search_table *search_table(val needle)
+{
+  val cached = gethash(search_table_hash, needle);
+  const wchar_t *n = c_str(needle);
+  cnum len = c_num(length_str(needle)), i;
+  struct search_table *st;
+
+  if (cached) {
+    st = (struct search_table *) cobj_handle(cached, search_table_s);
+    if (st->len == len && !wmemcmp(st->needle, n, len))
+      return st;
+  }
+
+  st = (struct search_table *) chk_malloc(sizeof *st);
+  st->len = len;
+  st->needle = (wchar_t *) chk_malloc((len + 1) * sizeof *st->needle);
+  wmemcpy(st->needle, n, len + 1);
+
+  for (i = 0; i < SEARCH_SKIP_SIZE; i++)
+    st->fwd[i] = st->rev[i] = len;
+
+  for (i = 0; i < len - 1; i++)
+    st->fwd[SEARCH_SKIP(n[i])] = len - 1 - i;
+
+  for (i = len - 1; i > 0; i--)
+    st->rev[SEARCH_SKIP(n[i])] = i;
+
+  sethash(search_table_hash, needle,
+          cobj((mem_t *) st, search_table_s, &search_table_ops));
+  return st;
+}
+
+static val search_narrow(struct search_table *st, const unsigned char *h,
+                         cnum lh, cnum start, val from_end)
+{
+  const wchar_t *n = st->needle;
+  cnum ln = st->len, pos;
+
+  if (from_end) {
+    for (pos = lh - ln; pos >= start; pos -= st->rev[SEARCH_SKIP(h[pos])])
+      if (narrow_eq(h + pos, n, ln))
+        return num(pos);
+  } else {
+    for (pos = start; pos + ln <= lh; pos += st->fwd[SEARCH_SKIP(h[pos + ln - 1])])
+      if (narrow_eq(h + pos, n, ln))
+        return num(pos);
+  }
+
+  return nil;
+}
+
 val search_str(val haystack, val needle, val start_num, val from_end)
 {
   uses_or2;
@@ -1641,45 +1893,424 @@ val search_str(val haystack, val needle, val start_num, val from_end)
 
   if (length_str_lt(haystack, start_num)) {
     return nil;
+  } else if (length_str_le(needle, zero)) {
+    return if3(from_end, length_str(haystack), start_num);
   } else {
-    val h_is_lazy = lazy_stringp(haystack);
-    cnum start = c_num(start_num);
-    cnum good = -1, pos = -1;
-    const wchar_t *n = c_str(needle), *h;
+    struct search_table *st = search_table(needle);
+    const wchar_t *n = st->needle, *h;
+    cnum ln = st->len, start = c_num(start_num), pos;
+
+    if (is_narrow_str(haystack))
+      return search_narrow(st, narrow_ptr(haystack),
+                           c_num(length_str(haystack)), start, from_end);
+
+    if (from_end) {
+      h = c_str(haystack);
+
+      for (pos = c_num(length_str(haystack)) - ln; pos >= start;
+           pos -= st->rev[SEARCH_SKIP(h[pos])])
+      {
+        if (!wmemcmp(h + pos, n, ln))
+          return num(pos);
+      }
+    } else {
+      /* A lazy haystack is forced only as far as the window reaches. */
+      val lstr = if2(lazy_stringp(haystack), haystack);
+      val str = if3(lstr, lstr->ls.prefix, haystack);
+      cnum lh = c_num(length_str(str));
+
+      for (pos = start; ; pos += st->fwd[SEARCH_SKIP(h[pos + ln - 1])]) {
+        if (pos + ln > lh) {
+          if (!lstr || !lazy_str_force_upto(lstr, num(pos + ln - 1)))
+            break;
+          str = lstr->ls.prefix;
+          lh = c_num(length_str(str));
+        }
 
-    if (!h_is_lazy) {
-      do {
-        const wchar_t *f;
-        h = c_str(haystack);
+        h = c_str(str);
 
-        f = wcsstr(h + start, n);
+        if (!wmemcmp(h + pos, n, ln))
+          return num(pos);
+      }
+    }
 
-        if (f)
-          pos = f - h;
-        else
-          pos = -1;
-      } while (pos != -1 && (good = pos) != -1 && from_end && h[start++]);
-    } else {
-      size_t ln = c_num(length_str(needle));
+    return nil;
+  }
+}
 
-      do {
-        lazy_str_force_upto(haystack, plus(num(start + 1), length_str(needle)));
-        h = c_str(haystack->ls.prefix);
+/*
+ * Aho-Corasick automaton over the strings of a string tree, for finding
+ * the earliest, longest match of any of them in a single pass, or the longest
+ * match at a given position. Like the search tables above, automata are
+ * cached in a weak hash keyed on the tree. An automaton is reused if the
+ * tree still has the same string objects as leaves, and none of them has
+ * been modified since the automaton was last used: the leaves are watched
+ * strings, and str_modify counts modifications of watched strings. If there
+ * have been any, the leaves are compared with copies of their old text.
+ */
+struct str_tree_node {
+  wchar_t ch;           /* character on the edge into this node */
+  int child, sibling;   /* trie, while under construction */
+  int edges, nedges;    /* outgoing edges, sorted by character */
+  int fail;             /* node for longest proper suffix */
+  int depth;            /* length of string spelled by node */
+  int term;             /* a string of the tree ends here */
+  int longest;          /* longest string of the tree which is a suffix */
+};
+
+struct str_tree_edge {
+  wchar_t ch;
+  int to;
+};
+
+struct str_tree_machine {
+  val leaves;           /* copies of the strings of the tree */
+  val objs;             /* the strings themselves */
+  cnum watch_count;     /* str_watch_count when leaves were last checked */
+  int nnodes, alloc;
+  int maxlen;
+  struct str_tree_node *node;
+  struct str_tree_edge *edge;
+};
+
+static val str_tree_machine_s;
+static val str_tree_machine_hash;
+
+static void str_tree_machine_destroy(val obj)
+{
+  struct str_tree_machine *m = (struct str_tree_machine *) obj->co.handle;
+  free(m->node);
+  free(m->edge);
+  free(m);
+  obj->co.handle = 0;
+}
+
+static void str_tree_machine_mark(val obj)
+{
+  struct str_tree_machine *m = (struct str_tree_machine *) obj->co.handle;
+  gc_mark(m->leaves);
+  gc_mark(m->objs);
+}
+
+static struct cobj_ops str_tree_machine_ops = {
+  cobj_equal_op,
+  cobj_print_op,
+  str_tree_machine_destroy,
+  str_tree_machine_mark,
+  cobj_hash_op
+};
+
+static val *str_tree_leaves(val tree, val *ptail)
+{
+  if (stringp(tree)) {
+    list_collect (ptail, copy_str(tree));
+  } else if (consp(tree)) {
+    for (; tree; tree = cdr(tree))
+      ptail = str_tree_leaves(car(tree), ptail);
+  }
+  return ptail;
+}
 
-        if (!wcsncmp(h + start, n, ln))
-          good = start;
-      } while (h[start++] && (from_end || good == -1));
+static val *str_tree_watch(val tree, val *ptail)
+{
+  if (stringp(tree)) {
+    val str = if3(lazy_stringp(tree), tree->ls.prefix, tree);
+    if (!is_lit(str))
+      str->st.watched = 1;
+    list_collect (ptail, tree);
+  } else if (consp(tree)) {
+    for (; tree; tree = cdr(tree))
+      ptail = str_tree_watch(car(tree), ptail);
+  }
+  return ptail;
+}
+
+static int str_tree_eq(val tree, val *pobjs)
+{
+  if (stringp(tree)) {
+    if (!*pobjs || car(*pobjs) != tree)
+      return 0;
+    *pobjs = cdr(*pobjs);
+  } else if (consp(tree)) {
+    for (; tree; tree = cdr(tree))
+      if (!str_tree_eq(car(tree), pobjs))
+        return 0;
+  }
+  return 1;
+}
+
+static val str_tree_same(val tree, val *pleaves)
+{
+  if (stringp(tree)) {
+    if (!*pleaves || !equal(car(*pleaves), tree))
+      return nil;
+    *pleaves = cdr(*pleaves);
+  } else if (consp(tree)) {
+    for (; tree; tree = cdr(tree))
+      if (!str_tree_same(car(tree), pleaves))
+        return nil;
+  }
+  return t;
+}
+
+static int str_tree_goto(struct str_tree_machine *m, int n, wchar_t ch)
+{
+  struct str_tree_edge *lo = m->edge + m->node[n].edges;
+  struct str_tree_edge *hi = lo + m->node[n].nedges;
+
+  while (lo < hi) {
+    struct str_tree_edge *mid = lo + (hi - lo) / 2;
+    if (mid->ch == ch)
+      return mid->to;
+    if (mid->ch < ch)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return -1;
+}
+
+static int str_tree_step(struct str_tree_machine *m, int n, wchar_t ch)
+{
+  for (;;) {
+    int next = str_tree_goto(m, n, ch);
+    if (next >= 0)
+      return next;
+    if (n == 0)
+      return 0;
+    n = m->node[n].fail;
+  }
+}
+
+static int str_tree_node_new(struct str_tree_machine *m, wchar_t ch, int depth)
+{
+  struct str_tree_node *n;
+
+  if (m->nnodes == m->alloc) {
+    m->alloc *= 2;
+    m->node = (struct str_tree_node *) chk_realloc((mem_t *) m->node,
+                                                   m->alloc * sizeof *m->node);
+  }
+
+  n = &m->node[m->nnodes];
+  n->ch = ch;
+  n->child = n->sibling = 0;
+  n->edges = n->nedges = 0;
+  n->fail = 0;
+  n->depth = depth;
+  n->term = 0;
+  n->longest = 0;
+  return m->nnodes++;
+}
+
+static void str_tree_insert(struct str_tree_machine *m, const wchar_t *str)
+{
+  int cur = 0;
+
+  for (; *str; str++) {
+    int prev = 0, next = m->node[cur].child;
+
+    while (next && m->node[next].ch < *str) {
+      prev = next;
+      next = m->node[next].sibling;
+    }
+
+    if (!next || m->node[next].ch != *str) {
+      int n = str_tree_node_new(m, *str, m->node[cur].depth + 1);
+      m->node[n].sibling = next;
+      if (prev)
+        m->node[prev].sibling = n;
+      else
+        m->node[cur].child = n;
+      next = n;
+    }
+
+    cur = next;
+  }
+
+  m->node[cur].term = 1;
+  if (m->node[cur].depth > m->maxlen)
+    m->maxlen = m->node[cur].depth;
+}
+
+static val str_tree_compile(val tree)
+{
+  struct str_tree_machine *m = (struct str_tree_machine *) chk_malloc(sizeof *m);
+  val leaves = nil, iter;
+  int *queue, head = 0, tail = 0, i, k = 0;
+  val obj;
+
+  list_collect_decl (out, ptail);
+  list_collect_decl (objs, otail);
+
+  str_tree_leaves(tree, ptail);
+  leaves = out;
+  str_tree_watch(tree, otail);
+
+  m->leaves = nil;
+  m->objs = nil;
+  m->watch_count = str_watch_count;
+  m->nnodes = 0;
+  m->alloc = 16;
+  m->maxlen = 0;
+  m->node = (struct str_tree_node *) chk_malloc(m->alloc * sizeof *m->node);
+  m->edge = 0;
+  obj = cobj((mem_t *) m, str_tree_machine_s, &str_tree_machine_ops);
+  m->leaves = leaves;
+  m->objs = objs;
+
+  str_tree_node_new(m, 0, 0);
+
+  for (iter = leaves; iter; iter = cdr(iter))
+    str_tree_insert(m, c_str(car(iter)));
+
+  m->edge = (struct str_tree_edge *) chk_malloc(m->nnodes * sizeof *m->edge);
+
+  for (i = 0; i < m->nnodes; i++) {
+    int c;
+    m->node[i].edges = k;
+    for (c = m->node[i].child; c; c = m->node[c].sibling, k++) {
+      m->edge[k].ch = m->node[c].ch;
+      m->edge[k].to = c;
+    }
+    m->node[i].nedges = k - m->node[i].edges;
+  }
+
+  queue = (int *) chk_malloc(m->nnodes * sizeof *queue);
+  queue[tail++] = 0;
+  m->node[0].longest = if3(m->node[0].term, 0, -1);
+
+  while (head < tail) {
+    int u = queue[head++], c;
+
+    for (c = m->node[u].child; c; c = m->node[c].sibling) {
+      struct str_tree_node *v = &m->node[c];
+      int f = 0;
+
+      if (u != 0)
+        f = str_tree_step(m, m->node[u].fail, v->ch);
+
+      v->fail = f;
+      v->longest = if3(v->term, v->depth, m->node[f].longest);
+      queue[tail++] = c;
+    }
+  }
+
+  free(queue);
+  return obj;
+}
+
+static struct str_tree_machine *str_tree_machine(val tree)
+{
+  val cached = gethash(str_tree_machine_hash, tree);
+
+  if (cached) {
+    struct str_tree_machine *m = (struct str_tree_machine *)
+                                 cobj_handle(cached, str_tree_machine_s);
+    val leaves = m->leaves, objs = m->objs;
+
+    if (str_tree_eq(tree, &objs) && !objs) {
+      if (m->watch_count == str_watch_count)
+        return m;
+      if (str_tree_same(tree, &leaves) && !leaves) {
+        m->watch_count = str_watch_count;
+        return m;
+      }
     }
-    return (good == -1) ? nil : num(good);
   }
+
+  cached = str_tree_compile(tree);
+  sethash(str_tree_machine_hash, tree, cached);
+  return (struct str_tree_machine *) cached->co.handle;
+}
+
+/*
+ * Scan for the earliest position at which any of the strings match, and
+ * the longest string matching there. Each node knows the longest string
+ * ending at the current position, which is the earliest-starting one.
+ * The scan stops once no string could start early enough to beat the
+ * best match found.
+ */
+static val str_tree_search(struct str_tree_machine *m, val haystack,
+                           val start_num)
+{
+  val lstr = if2(lazy_stringp(haystack), haystack);
+  val str = if3(lstr, lstr->ls.prefix, haystack);
+  cnum lh = c_num(length_str(str)), start = c_num(start_num), pos;
+  cnum best = -1, bestlen = 0;
+  int state = 0;
+
+  if (!m->leaves || length_str_lt(haystack, start_num))
+    return nil;
+
+  if (m->node[0].term)
+    best = start;
+
+  for (pos = start; best < 0 || pos - m->maxlen < best; pos++) {
+    int longest;
+
+    if (pos >= lh) {
+      if (!lstr || !lazy_str_force_upto(lstr, num(pos)))
+        break;
+      str = lstr->ls.prefix;
+      lh = c_num(length_str(str));
+    }
+
+    state = str_tree_step(m, state, str_ref(str, pos));
+    longest = m->node[state].longest;
+
+    if (longest > 0) {
+      cnum from = pos + 1 - longest;
+      if (best < 0 || from < best || (from == best && longest > bestlen)) {
+        best = from;
+        bestlen = longest;
+      }
+    }
+  }
+
+  return if2(best >= 0, cons(num(best), num(bestlen)));
+}
+
+/*
+ * Walk the trie from the given position, for the longest string matching
+ * there.
+ */
+static val str_tree_match(struct str_tree_machine *m, val bigstr, val pos)
+{
+  val lstr = if2(lazy_stringp(bigstr), bigstr);
+  val str = if3(lstr, lstr->ls.prefix, bigstr);
+  cnum lh = c_num(length_str(str)), i = c_num(pos);
+  int state = 0, longest = if3(m->node[0].term, 0, -1);
+
+  for (; state >= 0; i++) {
+    if (m->node[state].term)
+      longest = m->node[state].depth;
+
+    if (i >= lh) {
+      if (!lstr || !lazy_str_force_upto(lstr, num(i)))
+        break;
+      str = lstr->ls.prefix;
+      lh = c_num(length_str(str));
+    }
+
+    state = str_tree_goto(m, state, str_ref(str, i));
+  }
+
+  return if2(longest >= 0, num(longest));
 }
 
 val search_str_tree(val haystack, val tree, val start_num, val from_end)
 {
+  uses_or2;
+
   if (stringp(tree)) {
     val result = search_str(haystack, tree, start_num, from_end);
     if (result)
       return cons(result, length_str(tree));
+  } else if (consp(tree) && !from_end) {
+    return str_tree_search(str_tree_machine(tree), haystack,
+                           or2(start_num, zero));
   } else if (consp(tree)) {
     val it = nil, minpos = nil, maxlen = nil;
 
@@ -1708,6 +2339,30 @@ val match_str(val bigstr, val str, val pos)
   if (pos == nil)
     pos = zero;
 
+  if (!lazy_stringp(bigstr) && !lazy_stringp(str)) {
+    cnum lb = c_num(length_str(bigstr)), ls = c_num(length_str(str));
+    cnum start = c_num(pos), j;
+
+    if (ls == 0)
+      return t;
+
+    if (start + ls > lb)
+      return nil;
+
+    if (!is_narrow_str(bigstr) && !is_narrow_str(str))
+      return c_true(wmemcmp(c_str(bigstr) + start, c_str(str), ls) == 0);
+
+    if (is_narrow_str(bigstr) && is_narrow_str(str))
+      return c_true(memcmp(narrow_ptr(bigstr) + start, narrow_ptr(str),
+                           ls) == 0);
+
+    for (j = 0; j < ls; j++)
+      if (str_ref(bigstr, start + j) != str_ref(str, j))
+        return nil;
+
+    return t;
+  }
+
   for (i = zero;
        length_str_gt(bigstr, p = plus(pos, i)) && length_str_gt(str, i);
        i = plus(i, one))
@@ -1728,15 +2383,7 @@ val match_str_tree(val bigstr, val tree, val pos)
     if (match_str(bigstr, tree, pos))
       return length_str(tree);
   } else if (consp(tree)) {
-    val maxlen = nil;
-
-    for (; tree; tree = cdr(tree)) {
-      val result = match_str_tree(bigstr, car(tree), pos);
-      if (result && (!maxlen || gt(result, maxlen)))
-        maxlen = result;
-    }
-
-    return maxlen;
+    return str_tree_match(str_tree_machine(tree), bigstr, pos);
   }
 
   return nil;
@@ -1825,9 +2472,12 @@ val sub_str(val str_in, val from, val to)
 
   if (ge(from, to)) {
     return null_string;
+  } else if (is_narrow_str(str_in)) {
+    return narrow_string(narrow_ptr(str_in) + c_num(from),
+                         c_num(to) - c_num(from));
   } else {
     size_t nchar = c_num(to) - c_num(from) + 1;
-    wchar_t *sub = (wchar_t *) chk_malloc(nchar * sizeof (wchar_t));
+    wchar_t *sub = (wchar_t *) gc_payload_alloc(nchar * sizeof (wchar_t));
     const wchar_t *str = c_str(str_in);
     wcsncpy(sub, str + c_num(from), nchar);
     sub[nchar-1] = 0;
@@ -1845,6 +2495,11 @@ val replace_str(val str_in, val items, val from, val to)
     uw_throwf(error_s, lit("replace_str: string ~s of type ~s not supported"),
               str_in, typeof(str_in), nao);
 
+  str_modify(str_in, lit("replace_str"));
+
+  if (is_narrow_str(str_in))
+    str_widen(str_in);
+
   if (from == nil)
     from = zero;
   else if (from == t)
@@ -1937,7 +2592,7 @@ val cat_str(val list, val sep)
               item, nao);
   }
 
-  str = (wchar_t *) chk_malloc((total + 1) * sizeof *str);
+  str = (wchar_t *) gc_payload_alloc((total + 1) * sizeof *str);
 
   for (ptr = str, iter = list; iter != nil; iter = cdr(iter)) {
     val item = car(iter);
@@ -2071,7 +2726,7 @@ val trim_str(val str)
     return null_string;
   } else {
     size_t len = end - start;
-    wchar_t *buf = (wchar_t *) chk_malloc((len + 1) * sizeof *buf);
+    wchar_t *buf = (wchar_t *) gc_payload_alloc((len + 1) * sizeof *buf);
     wmemcpy(buf, start, len);
     buf[len] = 0;
     return string_own(buf);
@@ -2246,9 +2901,9 @@ val chr_str(val str, val ind)
 
   if (lazy_stringp(str)) {
     lazy_str_force_upto(str, ind);
-    return chr(c_str(str->ls.prefix)[index]);
+    return chr(str_ref(str->ls.prefix, index));
   } else {
-    return chr(c_str(str)[index]);
+    return chr(str_ref(str, index));
   }
 }
 
@@ -2265,11 +2920,23 @@ val chr_str_set(val str, val ind, val chr)
 
   if (lazy_stringp(str)) {
     lazy_str_force_upto(str, ind);
-    str->ls.prefix->st.str[index] = c_chr(chr);
-  } else {
-    str->st.str[index] = c_chr(chr);
+    str = str->ls.prefix;
+  }
+
+  str_modify(str, lit("chr_str_set"));
+
+  if (is_narrow_str(str)) {
+    wchar_t ch = c_chr(chr);
+
+    if (ch > 0 && ch < 256) {
+      narrow_ptr(str)[index] = ch;
+      return chr;
+    }
+
+    str_widen(str);
   }
 
+  str->st.str[index] = c_chr(chr);
   return chr;
 }
 
@@ -3159,7 +3826,7 @@ val vector(val length)
   int i;
   cnum alloc_plus = c_num(length) + 2;
   val vec = make_obj();
-  val *v = (val *) chk_malloc(alloc_plus * sizeof *v);
+  val *v = (val *) gc_payload_alloc(alloc_plus * sizeof *v);
 #ifdef HAVE_VALGRIND
   vec->v.vec_true_start = v;
 #endif
@@ -3191,8 +3858,9 @@ val vec_set_length(val vec, val length)
 
     if (alloc_delta > 0) {
       cnum new_alloc = max(new_length, 2*old_alloc);
-      val *newvec = (val *) chk_realloc((mem_t *) (vec->v.vec - 2),
-                                        (new_alloc + 2) * sizeof *newvec);
+      size_t size = (new_alloc + 2) * sizeof (val);
+      val *newvec = (val *) gc_payload_realloc((mem_t *) (vec->v.vec - 2),
+                                               size);
       vec->v.vec = newvec + 2;
       set(vec->v.vec[vec_alloc], num(new_alloc));
 #ifdef HAVE_VALGRIND
@@ -3283,7 +3951,7 @@ val copy_vec(val vec_in)
   val length = length_vec(vec_in);
   cnum alloc_plus = c_num(length) + 2;
   val vec = make_obj();
-  val *v = (val *) chk_malloc(alloc_plus * sizeof *v);
+  val *v = (val *) gc_payload_alloc(alloc_plus * sizeof *v);
 #ifdef HAVE_VALGRIND
   vec->v.vec_true_start = v;
 #endif
@@ -3324,7 +3992,7 @@ val sub_vec(val vec_in, val from, val to)
     cnum cfrom = c_num(from);
     size_t nelem = c_num(to) - cfrom;
     val vec = make_obj();
-    val *v = (val *) chk_malloc((nelem + 2) * sizeof *v);
+    val *v = (val *) gc_payload_alloc((nelem + 2) * sizeof *v);
 #ifdef HAVE_VALGRIND
     vec->v.vec_true_start = v;
 #endif
@@ -3423,7 +4091,7 @@ val cat_vec(val list)
     total += c_num(length_vec(car(iter)));
 
   vec = make_obj();
-  v = (val *) chk_malloc((total + 2) * sizeof *v);
+  v = (val *) gc_payload_alloc((total + 2) * sizeof *v);
 
 #ifdef HAVE_VALGRIND
   vec->v.vec_true_start = v;
@@ -3500,6 +4168,24 @@ val lazy_str(val lst, val term, val limit)
   return obj;
 }
 
+/*
+ * Append the next element of the list, and the terminator, to the prefix of a
+ * lazy string. The prefix is a string owned by the lazy string, which is
+ * extended in place. Its storage grows geometrically, so forcing a lazy string
+ * takes time proportional to its length, rather than copying the whole prefix
+ * for each element.
+ */
+static void lazy_str_extend(val lstr, val next, val term)
+{
+  val prefix = lstr->ls.prefix;
+
+  if (type(prefix) != STR)
+    set(lstr->ls.prefix, prefix = copy_str(prefix));
+
+  string_extend(prefix, next);
+  string_extend(prefix, term);
+}
+
 val lazy_str_force(val lstr)
 {
   val lim;
@@ -3509,7 +4195,7 @@ val lazy_str_force(val lstr)
   while ((!lim || gt(lim, zero)) && lstr->ls.list) {
     val next = pop(&lstr->ls.list);
     val term = car(lstr->ls.opts);
-    set(lstr->ls.prefix, cat_str(list(lstr->ls.prefix, next, term, nao), nil));
+    lazy_str_extend(lstr, next, term);
     if (lim)
       lim = minus(lim, one);
   }
@@ -3532,7 +4218,7 @@ val lazy_str_force_upto(val lstr, val index)
   {
     val next = pop(&lstr->ls.list);
     val term = car(lstr->ls.opts);
-    set(lstr->ls.prefix, cat_str(list(lstr->ls.prefix, next, term, nao), nil));
+    lazy_str_extend(lstr, next, term);
     if (lim)
       lim = minus(lim, one);
   }
@@ -4190,8 +4876,8 @@ static void obj_init(void)
   protect(&packages, &system_package, &keyword_package,
           &user_package, &null_string, &nil_string,
           &null_list, &equal_f, &eq_f, &eql_f, &car_f, &cdr_f, &null_f,
-          &identity_f, &prog_string, &env_list,
-          (val *) 0);
+          &identity_f, &prog_string, &env_list, &search_table_hash,
+          &str_tree_machine_hash, &str_wide_hash, (val *) 0);
 
   nil_string = lit("nil");
   null_string = lit("");
@@ -4303,6 +4989,8 @@ static void obj_init(void)
   args_k = intern(lit("args"), keyword_package);
   nothrow_k = intern(lit("nothrow"), keyword_package);
   colon_k = intern(lit(""), keyword_package);
+  search_table_s = intern(lit("search-table"), system_package);
+  str_tree_machine_s = intern(lit("str-tree-machine"), system_package);
 
   equal_f = func_n2(equal);
   eq_f = func_n2(eq);
@@ -4313,6 +5001,9 @@ static void obj_init(void)
   null_f = func_n1(nullp);
   gensym_counter = zero;
   prog_string = string(progname);
+  search_table_hash = make_hash(t, nil, nil);
+  str_tree_machine_hash = make_hash(t, nil, nil);
+  str_wide_hash = make_hash(t, nil, nil);
 }
 
 val obj_print(val obj, val out)
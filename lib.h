@@ -83,9 +83,13 @@ struct cons {
 
 struct string {
   obj_common;
-  wchar_t *str;
+  wchar_t *str;         /* unsigned char, if string is narrow */
   val len;
-  val alloc;
+  val alloc;            /* size of str in characters */
+  unsigned hash;        /* hash code plus one, or zero if not known */
+  unsigned interned : 1; /* made by intern_str: must not be modified */
+  unsigned narrow : 1;  /* str holds one byte per character */
+  unsigned watched : 1; /* leaf of a cached string tree automaton */
 };
 
 struct sym {
@@ -167,7 +171,7 @@ struct lazy_cons {
  */
 struct lazy_string {
   obj_common;
-  val prefix;           /* actual string part */
+  val prefix;           /* actual string part, extended in place */
   val list;             /* remaining list */
   val opts;             /* ( separator . limit ) */
 };
@@ -265,6 +269,15 @@ typedef struct wli wchli_t;
 #define wref(arr) (arr)
 #endif
 
+INLINE int is_narrow_str(val str)
+{
+  return is_ptr(str) && str->t.type == STR && str->st.narrow;
+}
+
+INLINE unsigned char *narrow_ptr(val str) { return (unsigned char *) str->st.str; }
+
+INLINE void str_hash_invalidate(val str) { str->st.hash = 0; }
+
 INLINE val auto_str(const wchli_t *str)
 {
   return (val) (((cnum) str) | TAG_LIT);
@@ -473,6 +486,7 @@ val expo(val);
 val string_own(wchar_t *str);
 val string(const wchar_t *str);
 val string_utf8(const char *str);
+val string_compact(const wchar_t *str, cnum len);
 val mkstring(val len, val ch);
 val mkustring(val len); /* must initialize immediately with init_str! */
 val init_str(val str, const wchar_t *);
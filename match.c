@@ -50,6 +50,7 @@
 int opt_nobindings = 0;
 int opt_lisp_bindings = 0;
 int opt_arraydims = 1;
+int opt_intern_strings = 0;
 
 val decline_k, next_spec_k, repeat_spec_k;
 val mingap_k, maxgap_k, gap_k, mintimes_k, maxtimes_k, times_k;
@@ -64,6 +65,7 @@ val filter_s;
 val noval_s;
 
 static val h_directive_table, v_directive_table;
+static val regex_set_hash;
 
 static void debuglf(val form, val fmt, ...)
 {
@@ -456,6 +458,14 @@ static val search_form(match_line_ctx *c, val needle_form, val from_end)
   }
 }
 
+/*
+ * Text from the data, about to be bound to a variable.
+ */
+static val bind_str(val str)
+{
+  return opt_intern_strings ? intern_str(str) : str;
+}
+
 static val h_var(match_line_ctx *c)
 {
   val elem = first(c->specline);
@@ -515,7 +525,8 @@ static val h_var(match_line_ctx *c)
 
     LOG_MATCH("var spanning form", new_pos);
     if (sym)
-      c->bindings = acons(sym, sub_str(c->dataline, c->pos, new_pos), new_bindings);
+      c->bindings = acons(sym, bind_str(sub_str(c->dataline, c->pos, new_pos)),
+                          new_bindings);
     c->pos = new_pos;
     /* This may have another variable attached */
     if (pat) {
@@ -531,7 +542,9 @@ static val h_var(match_line_ctx *c)
     }
     LOG_MATCH("count based var", past);
     if (sym)
-      c->bindings = acons(sym, trim_str(sub_str(c->dataline, c->pos, past)), c->bindings);
+      c->bindings = acons(sym,
+                          bind_str(trim_str(sub_str(c->dataline, c->pos, past))),
+                          c->bindings);
     c->pos = past;
     /* This may have another variable attached */
     if (pat) {
@@ -543,7 +556,8 @@ static val h_var(match_line_ctx *c)
               modifier, sym, nao);
   } else if (pat == nil) { /* no modifier, no elem -> to end of line */
     if (sym)
-      c->bindings = acons(sym, sub_str(c->dataline, c->pos, nil), c->bindings);
+      c->bindings = acons(sym, bind_str(sub_str(c->dataline, c->pos, nil)),
+                          c->bindings);
     c->pos = length_str(c->dataline);
   } else if (type(pat) == STR) {
     val find = search_str(c->dataline, pat, c->pos, modifier);
@@ -553,7 +567,8 @@ static val h_var(match_line_ctx *c)
     }
     LOG_MATCH("var delimiting string", find);
     if (sym)
-      c->bindings = acons(sym, sub_str(c->dataline, c->pos, find), c->bindings);
+      c->bindings = acons(sym, bind_str(sub_str(c->dataline, c->pos, find)),
+                          c->bindings);
     c->pos = plus(find, length_str(pat));
   } else if (consp(pat) && first(pat) != var_s) {
     val find = search_form(c, pat, modifier);
@@ -565,7 +580,8 @@ static val h_var(match_line_ctx *c)
     }
     LOG_MATCH("var delimiting form", fpos);
     if (sym)
-      c->bindings = acons(sym, sub_str(c->dataline, c->pos, fpos), c->bindings);
+      c->bindings = acons(sym, bind_str(sub_str(c->dataline, c->pos, fpos)),
+                          c->bindings);
     c->pos = if3(flen == t, t, plus(fpos, flen));
   } else if (consp(pat)) {
     /* Unbound var followed by var: the following one must either
@@ -594,13 +610,14 @@ static val h_var(match_line_ctx *c)
       /* Text from here to start of regex match goes to this
          variable. */
       if (sym)
-        c->bindings = acons(sym, sub_str(c->dataline, c->pos, fpos),
+        c->bindings = acons(sym, bind_str(sub_str(c->dataline, c->pos, fpos)),
                             c->bindings);
       /* Text from start of regex match to end goes to the
          second variable */
       if (second_sym)
         c->bindings = acons(second_sym,
-                            sub_str(c->dataline, fpos, plus(fpos, flen)),
+                            bind_str(sub_str(c->dataline, fpos,
+                                             plus(fpos, flen))),
                             c->bindings);
       LOG_MATCH("double var regex (first var)", fpos);
       c->pos = fpos;
@@ -624,13 +641,14 @@ static val h_var(match_line_ctx *c)
       return repeat_spec_k;
     }
   } else if (consp(pat) && (consp(first(pat)) || stringp(first(pat)))) {
-    cons_bind (find, len, search_str(c->dataline, pat, c->pos, modifier));
+    cons_bind (find, len, search_str_tree(c->dataline, pat, c->pos, modifier));
     if (!find) {
       LOG_MISMATCH("string");
       return nil;
     }
     if (sym)
-      c->bindings = acons(sym, sub_str(c->dataline, c->pos, find), c->bindings);
+      c->bindings = acons(sym, bind_str(sub_str(c->dataline, c->pos, find)),
+                          c->bindings);
     c->pos = plus(find, len);
   } else {
     sem_error(elem, lit("variable followed by invalid element"), nao);
@@ -2361,6 +2379,33 @@ static val v_next(match_files_ctx *c)
   }
 }
 
+/*
+ * If every clause of a parallel directive begins with a regex, a set
+ * made of those regexes tells, in one pass over the current line, which
+ * clauses can possibly match it; the others need not be tried. The set
+ * is made once for each directive, and remembered.
+ */
+static val parallel_regex_set(val specs)
+{
+  val found, rset = gethash_f(regex_set_hash, specs, &found);
+
+  if (!found) {
+    val regexes = nil, iter;
+
+    for (iter = specs; iter; iter = cdr(iter)) {
+      val elem = first(first(first(iter)));
+      if (!consp(elem) || !regexp(car(elem)))
+        break;
+      push(car(elem), &regexes);
+    }
+
+    rset = if2(!iter, regex_set_compile(nreverse(regexes)));
+    sethash(regex_set_hash, specs, rset);
+  }
+
+  return rset;
+}
+
 static val v_parallel(match_files_ctx *c)
 {
   spec_bind (specline, first_spec, c->spec);
@@ -2384,7 +2429,10 @@ static val v_parallel(match_files_ctx *c)
     val resolve = getplist(plist, resolve_k);
     val resolve_ub_vars = nil;
     val resolve_bindings = nil;
-    val iter;
+    val rset = if2(consp(c->data) && !opt_debugger,
+                   parallel_regex_set(specs));
+    val hits = if2(rset, regex_set_match(rset, car(c->data), zero));
+    val iter, index;
 
     if (choose_longest && choose_shortest)
       sem_error(specline, lit("choose: both :shortest and :longest specified"), nao);
@@ -2400,11 +2448,13 @@ static val v_parallel(match_files_ctx *c)
       }
     }
 
-    for (iter = specs; iter != nil; iter = rest(iter))
+    for (iter = specs, index = zero; iter != nil;
+         iter = rest(iter), index = plus(index, one))
     {
       val nested_spec = first(iter);
-      cons_bind (new_bindings, success, 
-                 match_files(mf_spec(*c, nested_spec)));
+      cons_bind (new_bindings, success,
+                 if3(rset && !memq(index, hits), nil,
+                     match_files(mf_spec(*c, nested_spec))));
 
       if (success) {
         some_match = t;
@@ -3542,25 +3592,23 @@ static val h_do(match_line_ctx *c)
   return next_spec_k;
 }
 
-static val match_files(match_files_ctx c)
+static val match_files_frame(match_files_ctx *c)
 {
   debug_enter;
 
-  gc_hint(c.data);
-
-  if (listp(c.data)) { /* recursive call with lazy list */
+  if (listp(c->data)) { /* recursive call with lazy list */
     ; /* no specia initialization */
-  } else if (c.files) { /* c.data == t: toplevel call with file list */
-    val source_spec = first(c.files);
+  } else if (c->files) { /* c->data == t: toplevel call with file list */
+    val source_spec = first(c->files);
     val name = consp(source_spec) ? cdr(source_spec) : source_spec;
     fpip_t fp = (errno = 0, complex_open(name, nil, nil));
-    spec_bind (specline, first_spec, c.spec);
+    spec_bind (specline, first_spec, c->spec);
 
     if (consp(first_spec) && eq(first(first_spec), next_s) && !rest(specline)) {
       debuglf(first_spec, lit("not opening source ~a "
                                    "since query starts with next directive"), name, nao);
     } else {
-      val spec = first(c.spec);
+      val spec = first(c->spec);
       debuglf(spec, lit("opening data source ~a"), name, nao);
 
       if (complex_open_failed(fp)) {
@@ -3576,24 +3624,24 @@ static val match_files(match_files_ctx c)
         debug_return (nil);
       }
 
-      c.files = cons(name, cdr(c.files)); /* Get rid of cons and nothrow */
+      c->files = cons(name, cdr(c->files)); /* Get rid of cons and nothrow */
 
-      if ((c.data = complex_snarf(fp, name)) != nil)
-        c.data_lineno = num(1);
+      if ((c->data = complex_snarf(fp, name)) != nil)
+        c->data_lineno = num(1);
     }
   } else { /* toplevel call with no data or file list */
-    c.data = nil;
+    c->data = nil;
   }
 
-  for (; c.spec; c.spec = rest(c.spec), 
-                 c.data = rest(c.data),
-                 c.data_lineno = plus(c.data_lineno, num(1)))
+  for (; c->spec; c->spec = rest(c->spec), 
+                 c->data = rest(c->data),
+                 c->data_lineno = plus(c->data_lineno, num(1)))
 repeat_spec_same_data:
   {
-    spec_bind (specline, first_spec, c.spec);
+    spec_bind (specline, first_spec, c->spec);
 
-    debug_check(first_spec, c.bindings, if2(consp(c.data), car(c.data)), 
-                c.data_lineno, nil, nil);
+    debug_check(first_spec, c->bindings, if2(consp(c->data), car(c->data)), 
+                c->data_lineno, nil, nil);
 
     if (consp(first_spec) && !rest(specline)) {
       val sym = first(first_spec);
@@ -3603,10 +3651,10 @@ repeat_spec_same_data:
         v_match_func vmf = (v_match_func) cptr_get(entry);
         val result;
 
-        result = vmf(&c);
+        result = vmf(c);
 
         if (result == next_spec_k) {
-          if ((c.spec = rest(c.spec)) == nil)
+          if ((c->spec = rest(c->spec)) == nil)
             break;
           goto repeat_spec_same_data;
         } else if (result == decline_k) {
@@ -3615,10 +3663,10 @@ repeat_spec_same_data:
           debug_return (result);
         }
       } else {
-        val result = v_fun(&c);
+        val result = v_fun(c);
 
         if (result == next_spec_k) {
-          if ((c.spec = rest(c.spec)) == nil)
+          if ((c->spec = rest(c->spec)) == nil)
             break;
           goto repeat_spec_same_data;
         } else if (result == decline_k) {
@@ -3629,30 +3677,47 @@ repeat_spec_same_data:
       }
     }
 
-    if (c.data)
+    if (c->data)
     {
-      val dataline = first(c.data);
+      val dataline = first(c->data);
 
       cons_bind (new_bindings, success,
-                 match_line_completely(ml_all(c.bindings, specline,
+                 match_line_completely(ml_all(c->bindings, specline,
                                               dataline, zero,
-                                              c.data_lineno, c.curfile)));
+                                              c->data_lineno, c->curfile)));
 
       if (!success)
         debug_return (nil);
 
-      c.bindings = new_bindings;
+      c->bindings = new_bindings;
     } else {
       debuglf(specline, lit("spec ran out of data"), nao);
       debug_return (nil);
     }
   }
 
-  debug_return (cons(c.bindings, if3(c.data, cons(c.data, c.data_lineno), t)));
+  debug_return (cons(c->bindings, if3(c->data, cons(c->data, c->data_lineno), t)));
 
   debug_leave;
 }
 
+/*
+ * The context is registered as a GC frame, so the data list
+ * being matched is held by a precise root, rather than by a copy
+ * that the compiler might keep in a register or stale stack slot.
+ */
+static val match_files(match_files_ctx c)
+{
+  gc_frame_t fr;
+  val result;
+
+  gc_frame_begin(&fr, &c.spec, &c.files, &c.curfile, &c.bindings,
+                 &c.data, &c.data_lineno, (val *) 0);
+  result = match_files_frame(&c);
+  gc_frame_end(&fr);
+  return result;
+}
+
 val match_filter(val name, val arg, val other_args)
 {
   cons_bind (in_spec, in_bindings, uw_get_match_context());
@@ -3769,7 +3834,10 @@ static void dir_tables_init(void)
   h_directive_table = make_hash(nil, nil, nil);
   v_directive_table = make_hash(nil, nil, nil);
 
-  protect(&h_directive_table, &v_directive_table, (val *) 0);
+  regex_set_hash = make_hash(t, nil, nil);
+
+  protect(&h_directive_table, &v_directive_table, &regex_set_hash,
+          (val *) 0);
 
   sethash(v_directive_table, skip_s, cptr((mem_t *) v_skip));
   sethash(v_directive_table, fuzz_s, cptr((mem_t *) v_fuzz));
@@ -39,18 +39,12 @@
 #include "regex.h"
 #include "txr.h"
 #include "gc.h"
+#include "hash.h"
 
 #if WCHAR_MAX > 65535
 #define FULL_UNICODE
 #endif
 
-typedef union nfa_state nfa_state_t;
-
-typedef struct nfa {
-  nfa_state_t *start;
-  nfa_state_t *accept;
-} nfa_t;
-
 typedef enum regm_result {
   REGM_INCOMPLETE, REGM_FAIL, REGM_MATCH
 } regm_result_t;
@@ -84,7 +78,7 @@ typedef unsigned int bitcell_t;
 #define CHAR_SET_L0_HI(CH) ((CH) | ((wchar_t) 0xFF))
 
 typedef enum {
-  CHSET_SMALL, CHSET_DISPLACED, CHSET_LARGE, 
+  CHSET_SMALL, CHSET_DISPLACED, CHSET_LARGE, CHSET_FLAT,
 #ifdef FULL_UNICODE
   CHSET_XLARGE
 #endif
@@ -135,6 +129,20 @@ struct xlarge_char_set {
 };
 #endif
 
+/*
+ * The form into which a set is converted once it is built: a bitmap of
+ * the first 256 characters, and a sorted array of disjoint ranges of
+ * the others, given as pairs of first and last character.
+ */
+struct flat_char_set {
+  unsigned type : 3;
+  unsigned comp : 1;
+  unsigned stat : 1;
+  cset_L0_t bitcell;
+  int nranges;
+  wchar_t *ranges;
+};
+
 typedef union char_set {
   struct any_char_set any;
   struct small_char_set s;
@@ -143,55 +151,135 @@ typedef union char_set {
 #ifdef FULL_UNICODE
   struct xlarge_char_set xl;
 #endif
+  struct flat_char_set f;
 } char_set_t;
 
-#define NFA_SET_SIZE 512
-
 typedef enum {
-  nfa_accept, nfa_empty, nfa_wild, nfa_single, nfa_set
+  nfa_accept, nfa_empty, nfa_wild, nfa_single, nfa_set, nfa_tag
 } nfa_kind_t;
 
-struct nfa_state_accept {
-  nfa_kind_t kind;
-  unsigned visited;
-};
+#define NFA_NONE (-1)
 
-struct nfa_state_empty {
+/*
+ * An NFA is a flat array of states, which refer to each other by index.
+ * The character sets of nfa_set states are kept in a table, and referred
+ * to by index also. Freeing an NFA therefore doesn't require a traversal
+ * of its graph. The stamps which mark states as visited in the closure
+ * computation are kept apart from the states, in a parallel array.
+ */
+typedef struct nfa_state {
   nfa_kind_t kind;
-  unsigned visited;
-  nfa_state_t *trans0;
-  nfa_state_t *trans1;
-};
+  int trans0;   /* successor; first empty transition of nfa_empty */
+  int trans1;   /* second empty transition of nfa_empty */
+  int set;      /* index of character set of nfa_set; in a regex set,
+                   index of the regex whose nfa_accept state it is;
+                   index of the tag recorded by nfa_tag */
+  wchar_t ch;   /* character of nfa_single */
+} nfa_state_t;
 
-struct nfa_state_single {
-  nfa_kind_t kind;
-  unsigned visited;
-  nfa_state_t *trans;
-  wchar_t ch;
-};
+typedef struct nfa {
+  nfa_state_t *states;
+  unsigned *visited;
+  char_set_t **sets;
+  int nstates, nsets;
+  int states_alloc, sets_alloc;
+  int start, accept;
+  unsigned stamp;
+} nfa_t;
 
-struct nfa_state_set {
-  nfa_kind_t kind;
-  unsigned visited;
-  nfa_state_t *trans;
-  char_set_t *set;
-};
+/*
+ * A fragment of an NFA under construction: a start and accept state.
+ */
+typedef struct nfa_frag {
+  int start;
+  int accept;
+} nfa_frag_t;
 
-union nfa_state {
-  struct nfa_state_accept a;
-  struct nfa_state_empty e;
-  struct nfa_state_single o;
-  struct nfa_state_set s;
+/*
+ * Lazy DFA: each DFA state stands for an epsilon-closed set of NFA states,
+ * sorted so that equal sets can be found in a hash table. States are made
+ * on demand, when a transition is first taken. Transitions on characters
+ * below DFA_CACHE_CHARS are cached in the source state, in a table indexed
+ * by character. The others are cached in a small table of the most recently
+ * taken ones, indexed by the character modulo DFA_WIDE_CACHE; on a miss,
+ * the transition is worked out from the NFA set, which finds the target
+ * state in the hash table. A regex gets at most DFA_MAX_STATES states; after
+ * that, matching carries on by simulating the NFA from the closure at
+ * which the DFA ran out.
+ */
+#define DFA_CACHE_CHARS 256
+#define DFA_WIDE_CACHE 8
+#define DFA_MAX_STATES 256
+#define DFA_HASH_SIZE 256
+
+typedef struct dfa_state dfa_state_t;
+
+struct dfa_state {
+  dfa_state_t *next;
+  unsigned long hash;
+  int accept;
+  int nstates;
+  dfa_state_t *trans[DFA_CACHE_CHARS];
+  wchar_t wide_ch[DFA_WIDE_CACHE];
+  dfa_state_t *wide_trans[DFA_WIDE_CACHE];
+  int set[1];
 };
 
+typedef struct dfa {
+  dfa_state_t *table[DFA_HASH_SIZE];
+  dfa_state_t *start;
+  int count;
+  int *move, *clos, *stack;
+  int nclos, accept;
+} dfa_t;
+
+/*
+ * Bit-parallel Glushkov automaton, for regexes with few enough positions
+ * (occurrences of characters, sets and wildcards) that a set of them fits
+ * in a machine word. State 0 is the initial state, and position p is bit p.
+ * The follow sets are tabulated by 8-bit chunks of the state set, so that
+ * a step takes a table lookup per chunk, and a mask of the positions
+ * matching the character.
+ */
+typedef uint_ptr_t bp_mask_t;
+
+#define BP_MAX_POS ((int) (sizeof (bp_mask_t) * CHAR_BIT))
+#define BP_CHUNK_BITS 8
+#define BP_CHUNK_SIZE (1 << BP_CHUNK_BITS)
+#define BP_CACHE_CHARS 256
+#define BP_BIT(P) ((bp_mask_t) 1 << (P))
+
+typedef struct bp {
+  int npos;
+  bp_mask_t last;
+  bp_mask_t *follow;
+  bp_mask_t cmask[BP_CACHE_CHARS];
+  nfa_kind_t kind[BP_MAX_POS];
+  wchar_t ch[BP_MAX_POS];
+  char_set_t *set[BP_MAX_POS];
+} bp_t;
+
+typedef struct nfa_regex {
+  nfa_t nfa;
+  dfa_t *dfa;
+  bp_t *bp;
+  val source;
+  val reverse;
+  val literals;
+  int nregex;
+} nfa_regex_t;
+
 struct nfa_machine {
   int is_nfa;           /* common member */
   cnum last_accept_pos; /* common member */
   cnum count;           /* common member */
-  unsigned visited;
-  nfa_state_t **move, **clos, **stack;
+  int *move, *clos, *stack;
   int nmove, nclos;
-  nfa_t nfa;
+  nfa_t *nfa;
+  dfa_t *dfa;
+  bp_t *bp;
+  bp_mask_t bstate;
+  dfa_state_t *dstate;  /* null when simulating the NFA */
 };
 
 struct dv_machine {
@@ -200,6 +288,7 @@ struct dv_machine {
   cnum count;           /* common member */
   val deriv;
   val regex;
+  val memo;
 };
 
 union regex_machine {
@@ -233,7 +322,8 @@ static void L0_fill_range(cset_L0_t *L0, wchar_t ch0, wchar_t ch1)
   bitcell_t mask0 = ~(((bitcell_t) 1 << bt0) - 1);
   int bt1 = CHAR_SET_BIT(ch1);
   int bc1 = CHAR_SET_INDEX(ch1);
-  bitcell_t mask1 = (((bitcell_t) 1 << (bt1 + 1) % 32) - 1);
+  bitcell_t mask1 = if3(bt1 + 1 < (int) (sizeof (bitcell_t) * CHAR_BIT),
+                       ((bitcell_t) 1 << (bt1 + 1)) - 1, BITCELL_ALL1);
 
   if (bc1 == bc0) {
     (*L0)[bc0] |= (mask0 & mask1);
@@ -247,7 +337,7 @@ static void L0_fill_range(cset_L0_t *L0, wchar_t ch0, wchar_t ch1)
 
 static int L0_contains(cset_L0_t *L0, wchar_t ch)
 {
-  return ((*L0)[CHAR_SET_INDEX(ch)] & (1 << CHAR_SET_BIT(ch))) != 0;
+  return ((*L0)[CHAR_SET_INDEX(ch)] & ((bitcell_t) 1 << CHAR_SET_BIT(ch))) != 0;
 }
 
 static int L1_full(cset_L1_t *L1)
@@ -271,7 +361,8 @@ static void L1_fill_range(cset_L1_t *L1, wchar_t ch0, wchar_t ch1)
     cset_L0_t *L0;
 
     if (i1 > i10 && i1 < i11) {
-      free((*L1)[i1]);
+      if ((*L1)[i1] != (cset_L0_t *) -1)
+        free((*L1)[i1]);
       (*L1)[i1] = (cset_L0_t *) -1;
       continue;
     } else if (i10 == i11) {
@@ -352,7 +443,10 @@ static void L2_fill_range(cset_L2_t *L2, wchar_t ch0, wchar_t ch1)
     cset_L1_t *L1;
 
     if (i2 > i20 && i2 < i21) {
-      free((*L2)[i2]);
+      if ((*L2)[i2] != (cset_L1_t *) -1 && (*L2)[i2] != 0) {
+        L1_free((*L2)[i2]);
+        free((*L2)[i2]);
+      }
       (*L2)[i2] = (cset_L1_t *) -1;
       continue;
     } else if (i20 == i21) {
@@ -424,7 +518,10 @@ static void L3_fill_range(cset_L3_t *L3, wchar_t ch0, wchar_t ch1)
     cset_L2_t *L2;
 
     if (i3 > i30 && i3 < i31) {
-      free((*L3)[i3]);
+      if ((*L3)[i3] != (cset_L2_t *) -1 && (*L3)[i3] != 0) {
+        L2_free((*L3)[i3]);
+        free((*L3)[i3]);
+      }
       (*L3)[i3] = (cset_L2_t *) -1;
       continue;
     } else if (i30 == i31) {
@@ -504,6 +601,10 @@ static void char_set_destroy(char_set_t *set)
     return;
 
   switch (set->any.type) {
+  case CHSET_FLAT:
+    free(set->f.ranges);
+    free(set);
+    break;
   case CHSET_DISPLACED:
   case CHSET_SMALL:
     free(set);
@@ -535,7 +636,7 @@ static void char_set_add(char_set_t *set, wchar_t ch)
     /* fallthrough */
   case CHSET_SMALL:
     assert (ch < 256);
-    set->s.bitcell[CHAR_SET_INDEX(ch)] |= (1 << CHAR_SET_BIT(ch));
+    set->s.bitcell[CHAR_SET_INDEX(ch)] |= ((bitcell_t) 1 << CHAR_SET_BIT(ch));
     break;
   case CHSET_LARGE:
     assert (ch < 0x10000);
@@ -552,7 +653,7 @@ static void char_set_add(char_set_t *set, wchar_t ch)
 
 static void char_set_add_range(char_set_t *set, wchar_t ch0, wchar_t ch1)
 {
-  if (ch0 >= ch1)
+  if (ch0 > ch1)
     return;
 
   switch (set->any.type) {
@@ -584,11 +685,162 @@ static void char_set_add_str(char_set_t *set, wchar_t *str)
     char_set_add(set, *str++);
 }
 
+/*
+ * Accumulates the ranges of a set, merging adjacent ones.
+ */
+typedef struct char_set_ranges {
+  wchar_t *ranges;
+  int nranges, alloc;
+} char_set_ranges_t;
+
+static void ranges_add(char_set_ranges_t *rs, wchar_t ch0, wchar_t ch1)
+{
+  if (rs->nranges && rs->ranges[2 * rs->nranges - 1] + 1 == ch0) {
+    rs->ranges[2 * rs->nranges - 1] = ch1;
+    return;
+  }
+
+  if (rs->nranges == rs->alloc) {
+    rs->alloc = if3(rs->alloc, rs->alloc * 2, 8);
+    rs->ranges = (wchar_t *) chk_realloc((mem_t *) rs->ranges,
+                                         2 * rs->alloc * sizeof *rs->ranges);
+  }
+
+  rs->ranges[2 * rs->nranges] = ch0;
+  rs->ranges[2 * rs->nranges + 1] = ch1;
+  rs->nranges++;
+}
+
+static void L0_ranges(char_set_ranges_t *rs, cset_L0_t *L0, wchar_t base)
+{
+  int i;
+
+  for (i = 0; i < 256; i++)
+    if (L0_contains(L0, i))
+      ranges_add(rs, base + i, base + i);
+}
+
+static void L1_ranges(char_set_ranges_t *rs, cset_L1_t *L1, wchar_t base)
+{
+  int i1;
+
+  for (i1 = 0; i1 < 16; i1++, base += 0x100) {
+    cset_L0_t *L0 = (*L1)[i1];
+    if (L0 == (cset_L0_t *) -1)
+      ranges_add(rs, base, base + 0xFF);
+    else if (L0 != 0)
+      L0_ranges(rs, L0, base);
+  }
+}
+
+static void L2_ranges(char_set_ranges_t *rs, cset_L2_t *L2, wchar_t base)
+{
+  int i2;
+
+  for (i2 = 0; i2 < 16; i2++, base += 0x1000) {
+    cset_L1_t *L1 = (*L2)[i2];
+    if (L1 == (cset_L1_t *) -1)
+      ranges_add(rs, base, base + 0xFFF);
+    else if (L1 != 0)
+      L1_ranges(rs, L1, base);
+  }
+}
+
+#ifdef FULL_UNICODE
+static void L3_ranges(char_set_ranges_t *rs, cset_L3_t *L3)
+{
+  int i3;
+  wchar_t base = 0;
+
+  for (i3 = 0; i3 < 17; i3++, base += 0x10000) {
+    cset_L2_t *L2 = (*L3)[i3];
+    if (L2 == (cset_L2_t *) -1)
+      ranges_add(rs, base, base + 0xFFFF);
+    else if (L2 != 0)
+      L2_ranges(rs, L2, base);
+  }
+}
+#endif
+
+/*
+ * Convert a set to the flat representation, once all of its
+ * characters have been added.
+ */
+static void char_set_flatten(char_set_t *set)
+{
+  static cset_L0_t blank;
+  char_set_ranges_t rs = { 0, 0, 0 };
+  cset_L0_t lo;
+  int i, j;
+
+  switch (set->any.type) {
+  case CHSET_SMALL:
+    L0_ranges(&rs, &set->s.bitcell, 0);
+    break;
+  case CHSET_DISPLACED:
+    L0_ranges(&rs, &set->d.bitcell, set->d.base);
+    break;
+  case CHSET_LARGE:
+    L2_ranges(&rs, &set->l.dir, 0);
+    L2_free(&set->l.dir);
+    break;
+#ifdef FULL_UNICODE
+  case CHSET_XLARGE:
+    L3_ranges(&rs, &set->xl.dir);
+    L3_free(&set->xl.dir);
+    break;
+#endif
+  case CHSET_FLAT:
+    return;
+  }
+
+  memcpy(&lo, &blank, sizeof lo);
+
+  for (i = j = 0; i < rs.nranges; i++) {
+    wchar_t ch0 = rs.ranges[2 * i], ch1 = rs.ranges[2 * i + 1];
+
+    if (ch0 < 256) {
+      L0_fill_range(&lo, ch0, if3(ch1 < 256, ch1, 255));
+      if (ch1 < 256)
+        continue;
+      ch0 = 256;
+    }
+
+    rs.ranges[2 * j] = ch0;
+    rs.ranges[2 * j++ + 1] = ch1;
+  }
+
+  set->f.type = CHSET_FLAT;
+  memcpy(&set->f.bitcell, &lo, sizeof lo);
+  set->f.nranges = j;
+  set->f.ranges = rs.ranges;
+}
+
 static int char_set_contains(char_set_t *set, wchar_t ch)
 {
   int result = 0;
 
   switch (set->any.type) {
+  case CHSET_FLAT:
+    if (ch < 256) {
+      result = L0_contains(&set->f.bitcell, ch);
+    } else {
+      const wchar_t *r = set->f.ranges;
+      int lo = 0, hi = set->f.nranges;
+
+      while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (ch < r[2 * mid])
+          hi = mid;
+        else if (ch > r[2 * mid + 1])
+          lo = mid + 1;
+        else
+          break;
+      }
+
+      result = (lo < hi);
+    }
+    break;
   case CHSET_DISPLACED:
     if (ch < set->d.base)
       break;
@@ -713,6 +965,7 @@ static char_set_t *char_set_compile(val args, val comp)
     if (comp)
       char_set_compl(set);
 
+    char_set_flatten(set);
     return set;
   }
 }
@@ -745,6 +998,13 @@ static void init_special_char_sets(void)
   char_set_add_range(cword_cs, 'a', 'z');
   char_set_add(word_cs, '_');
   char_set_add(cword_cs, '_');
+
+  char_set_flatten(space_cs);
+  char_set_flatten(cspace_cs);
+  char_set_flatten(digit_cs);
+  char_set_flatten(cdigit_cs);
+  char_set_flatten(word_cs);
+  char_set_flatten(cword_cs);
 }
 
 static void char_set_cobj_destroy(val chset)
@@ -762,63 +1022,72 @@ static struct cobj_ops char_set_obj_ops = {
   cobj_hash_op
 };
 
-static nfa_state_t *nfa_state_accept(void)
+static int nfa_state_new(nfa_t *nfa, nfa_kind_t kind, int t0, int t1)
 {
-  nfa_state_t *st = (nfa_state_t *) chk_malloc(sizeof *st);
-  st->a.kind = nfa_accept;
-  st->a.visited = 0;
-  return st;
+  nfa_state_t *st;
+
+  if (nfa->nstates == nfa->states_alloc) {
+    nfa->states_alloc = if3(nfa->states_alloc, nfa->states_alloc * 2, 16);
+    nfa->states = (nfa_state_t *) chk_realloc((mem_t *) nfa->states,
+                                              nfa->states_alloc *
+                                              sizeof *nfa->states);
+  }
+
+  st = &nfa->states[nfa->nstates];
+  st->kind = kind;
+  st->trans0 = t0;
+  st->trans1 = t1;
+  st->set = NFA_NONE;
+  st->ch = 0;
+  return nfa->nstates++;
 }
 
-static nfa_state_t *nfa_state_empty(nfa_state_t *t0, nfa_state_t *t1)
+static int nfa_state_accept(nfa_t *nfa)
 {
-  nfa_state_t *st = (nfa_state_t *) chk_malloc(sizeof *st);
-  st->e.kind = nfa_empty;
-  st->e.visited = 0;
-  st->e.trans0 = t0;
-  st->e.trans1 = t1;
-  return st;
+  return nfa_state_new(nfa, nfa_accept, NFA_NONE, NFA_NONE);
 }
 
-static nfa_state_t *nfa_state_single(nfa_state_t *t, wchar_t ch)
+static int nfa_state_empty(nfa_t *nfa, int t0, int t1)
 {
-  nfa_state_t *st = (nfa_state_t *) chk_malloc(sizeof *st);
-  st->o.kind = nfa_single;
-  st->o.visited = 0;
-  st->o.trans = t;
-  st->o.ch = ch;
-  return st;
+  return nfa_state_new(nfa, nfa_empty, t0, t1);
 }
 
-static nfa_state_t *nfa_state_wild(nfa_state_t *t)
+static int nfa_state_single(nfa_t *nfa, int t, wchar_t ch)
 {
-  nfa_state_t *st = (nfa_state_t *) chk_malloc(sizeof *st);
-  st->o.kind = nfa_wild;
-  st->o.visited = 0;
-  st->o.trans = t;
-  st->o.ch = 0;
+  int st = nfa_state_new(nfa, nfa_single, t, NFA_NONE);
+  nfa->states[st].ch = ch;
   return st;
 }
 
-static void nfa_state_free(nfa_state_t *st)
+static int nfa_state_wild(nfa_t *nfa, int t)
 {
-  if (st->a.kind == nfa_set)
-    char_set_destroy(st->s.set);
-  free(st);
+  return nfa_state_new(nfa, nfa_wild, t, NFA_NONE);
 }
 
-static void nfa_state_shallow_free(nfa_state_t *st)
+/*
+ * The set is entered into the table of the NFA, which owns it from then
+ * on. The same set is entered only once.
+ */
+static int nfa_state_set(nfa_t *nfa, int t, char_set_t *cs)
 {
-  free(st);
-}
+  int st = nfa_state_new(nfa, nfa_set, t, NFA_NONE);
+  int i;
 
-static nfa_state_t *nfa_state_set(nfa_state_t *t, char_set_t *cs)
-{
-  nfa_state_t *st = (nfa_state_t *) chk_malloc(sizeof *st);
-  st->s.kind = nfa_set;
-  st->s.visited = 0;
-  st->s.trans = t;
-  st->s.set = cs;
+  for (i = 0; i < nfa->nsets; i++)
+    if (nfa->sets[i] == cs)
+      break;
+
+  if (i == nfa->nsets) {
+    if (nfa->nsets == nfa->sets_alloc) {
+      nfa->sets_alloc = if3(nfa->sets_alloc, nfa->sets_alloc * 2, 4);
+      nfa->sets = (char_set_t **) chk_realloc((mem_t *) nfa->sets,
+                                              nfa->sets_alloc *
+                                              sizeof *nfa->sets);
+    }
+    nfa->sets[nfa->nsets++] = cs;
+  }
+
+  nfa->states[st].set = i;
   return st;
 }
 
@@ -830,13 +1099,13 @@ static nfa_state_t *nfa_state_set(nfa_state_t *t, char_set_t *cs)
  * either back to itself, or to a new state in the
  * surrounding new NFA.
  */
-static void nfa_state_empty_convert(nfa_state_t *acc, nfa_state_t *t0,
-                                    nfa_state_t *t1)
+static void nfa_state_empty_convert(nfa_t *nfa, int acc, int t0, int t1)
 {
-  assert (acc->a.kind == nfa_accept);
-  acc->e.kind = nfa_empty;
-  acc->e.trans0 = t0;
-  acc->e.trans1 = t1;
+  nfa_state_t *st = &nfa->states[acc];
+  assert (st->kind == nfa_accept);
+  st->kind = nfa_empty;
+  st->trans0 = t0;
+  st->trans1 = t1;
 }
 
 /*
@@ -852,16 +1121,27 @@ static void nfa_state_empty_convert(nfa_state_t *acc, nfa_state_t *t0,
  * operators terminate their backwards arrows on an
  * existing start state, and allocate a new start
  * state in front of it.
+ *
+ * The st state is no longer needed. If it is the last one allocated, it
+ * is given back; otherwise it stays in the array as an unreachable hole.
  */
-static void nfa_state_merge(nfa_state_t *acc, nfa_state_t *st)
+static void nfa_state_merge(nfa_t *nfa, int acc, int st)
 {
-  assert (acc->a.kind == nfa_accept);
-  *acc = *st;
+  assert (nfa->states[acc].kind == nfa_accept);
+  nfa->states[acc] = nfa->states[st];
+
+  if (st == nfa->nstates - 1) {
+    nfa->nstates--;
+  } else {
+    nfa->states[st].kind = nfa_empty;
+    nfa->states[st].trans0 = NFA_NONE;
+    nfa->states[st].trans1 = NFA_NONE;
+  }
 }
 
-static nfa_t nfa_make(nfa_state_t *s, nfa_state_t *acc)
+static nfa_frag_t nfa_make(int s, int acc)
 {
-  nfa_t ret;
+  nfa_frag_t ret;
   ret.start = s;
   ret.accept = acc;
   return ret;
@@ -872,45 +1152,41 @@ static nfa_t nfa_make(nfa_state_t *s, nfa_state_t *acc)
  * The acceptance state of the predecessor is merged with the start state of
  * the successor.
  */
-static nfa_t nfa_combine(nfa_t pred, nfa_t succ)
+static nfa_frag_t nfa_combine(nfa_t *nfa, nfa_frag_t pred, nfa_frag_t succ)
 {
-  nfa_t ret;
+  nfa_frag_t ret;
   ret.start = pred.start;
   ret.accept = succ.accept;
-  nfa_state_merge(pred.accept, succ.start);
-  nfa_state_shallow_free(succ.start); /* No longer needed. */
+  nfa_state_merge(nfa, pred.accept, succ.start);
   return ret;
 }
 
-static nfa_t nfa_compile_set(val args, val comp)
+static nfa_frag_t nfa_compile_given_set(nfa_t *nfa, char_set_t *set)
 {
-  char_set_t *set = char_set_compile(args, comp);
-  nfa_state_t *acc = nfa_state_accept();
-  nfa_state_t *s = nfa_state_set(acc, set);
+  int acc = nfa_state_accept(nfa);
+  int s = nfa_state_set(nfa, acc, set);
   return nfa_make(s, acc);
 }
 
-static nfa_t nfa_compile_given_set(char_set_t *set)
+static nfa_frag_t nfa_compile_set(nfa_t *nfa, val args, val comp)
 {
-  nfa_state_t *acc = nfa_state_accept();
-  nfa_state_t *s = nfa_state_set(acc, set);
-  return nfa_make(s, acc);
+  return nfa_compile_given_set(nfa, char_set_compile(args, comp));
 }
 
-static nfa_t nfa_compile_regex(val regex);
+static nfa_frag_t nfa_compile_regex(nfa_t *nfa, val regex);
 
 /*
  * Helper to nfa_compile_regex for compiling the argument list of
  * a compound regex.
  */
 
-static nfa_t nfa_compile_list(val exp_list)
+static nfa_frag_t nfa_compile_list(nfa_t *nfa, val exp_list)
 {
-  nfa_t nfa_first = nfa_compile_regex(first(exp_list));
+  nfa_frag_t nfa_first = nfa_compile_regex(nfa, first(exp_list));
 
   if (rest(exp_list)) {
-    nfa_t nfa_rest = nfa_compile_list(rest(exp_list));
-    return nfa_combine(nfa_first, nfa_rest);
+    nfa_frag_t nfa_rest = nfa_compile_list(nfa, rest(exp_list));
+    return nfa_combine(nfa, nfa_first, nfa_rest);
   } else {
     return nfa_first;
   }
@@ -921,83 +1197,83 @@ static nfa_t nfa_compile_list(val exp_list)
  * not including the regex symbol.
  * I.e.  (rest '(regex ...)) not '(regex ...).
  */
-static nfa_t nfa_compile_regex(val exp)
+static nfa_frag_t nfa_compile_regex(nfa_t *nfa, val exp)
 {
   if (nullp(exp)) {
-    nfa_state_t *acc = nfa_state_accept();
-    nfa_state_t *s = nfa_state_empty(acc, 0);
+    int acc = nfa_state_accept(nfa);
+    int s = nfa_state_empty(nfa, acc, NFA_NONE);
     return nfa_make(s, acc);
   } else if (chrp(exp)) {
-    nfa_state_t *acc = nfa_state_accept();
-    nfa_state_t *s = nfa_state_single(acc, c_chr(exp));
+    int acc = nfa_state_accept(nfa);
+    int s = nfa_state_single(nfa, acc, c_chr(exp));
     return nfa_make(s, acc);
   } else if (stringp(exp)) {
-    return nfa_compile_regex(cons(compound_s, list_str(exp)));
+    return nfa_compile_regex(nfa, cons(compound_s, list_str(exp)));
   } else if (exp == wild_s) {
-    nfa_state_t *acc = nfa_state_accept();
-    nfa_state_t *s = nfa_state_wild(acc);
+    int acc = nfa_state_accept(nfa);
+    int s = nfa_state_wild(nfa, acc);
     return nfa_make(s, acc);
   } else if (exp == space_k) {
-    return nfa_compile_given_set(space_cs);
+    return nfa_compile_given_set(nfa, space_cs);
   } else if (exp == digit_k) {
-    return nfa_compile_given_set(digit_cs);
+    return nfa_compile_given_set(nfa, digit_cs);
   } else if (exp == word_char_k) {
-    return nfa_compile_given_set(word_cs);
+    return nfa_compile_given_set(nfa, word_cs);
   } else if (exp == cspace_k) {
-    return nfa_compile_given_set(cspace_cs);
+    return nfa_compile_given_set(nfa, cspace_cs);
   } else if (exp == cdigit_k) {
-    return nfa_compile_given_set(cdigit_cs);
+    return nfa_compile_given_set(nfa, cdigit_cs);
   } else if (exp == cword_char_k) {
-    return nfa_compile_given_set(cword_cs);
+    return nfa_compile_given_set(nfa, cword_cs);
   } else if (consp(exp)) {
     val sym = first(exp), args = rest(exp);
 
     if (sym == set_s) {
-      return nfa_compile_set(args, nil);
+      return nfa_compile_set(nfa, args, nil);
     } else if (sym == cset_s) {
-      return nfa_compile_set(args, t);
+      return nfa_compile_set(nfa, args, t);
     } else if (sym == compound_s) {
-      return nfa_compile_list(args);
+      return nfa_compile_list(nfa, args);
     } else if (sym == zeroplus_s) {
-      nfa_t nfa_arg = nfa_compile_regex(first(args));
-      nfa_state_t *acc = nfa_state_accept();
+      nfa_frag_t nfa_arg = nfa_compile_regex(nfa, first(args));
+      int acc = nfa_state_accept(nfa);
       /* New start state has empty transitions going through
          the inner NFA, or skipping it right to the new acceptance state. */
-      nfa_state_t *s = nfa_state_empty(nfa_arg.start, acc);
+      int s = nfa_state_empty(nfa, nfa_arg.start, acc);
       /* Convert acceptance state of inner NFA to one which has
          an empty transition back to the start state, and
          an empty transition to the new acceptance state. */
-      nfa_state_empty_convert(nfa_arg.accept, nfa_arg.start, acc);
+      nfa_state_empty_convert(nfa, nfa_arg.accept, nfa_arg.start, acc);
       return nfa_make(s, acc);
     } else if (sym == oneplus_s) {
       /* One-plus case differs from zero-plus in that the new start state
          does not have an empty transition to the acceptance state.
          So the inner NFA must be traversed once. */
-      nfa_t nfa_arg = nfa_compile_regex(first(args));
-      nfa_state_t *acc = nfa_state_accept();
-      nfa_state_t *s = nfa_state_empty(nfa_arg.start, 0); /* <-- diff */
-      nfa_state_empty_convert(nfa_arg.accept, nfa_arg.start, acc);
+      nfa_frag_t nfa_arg = nfa_compile_regex(nfa, first(args));
+      int acc = nfa_state_accept(nfa);
+      int s = nfa_state_empty(nfa, nfa_arg.start, NFA_NONE); /* <-- diff */
+      nfa_state_empty_convert(nfa, nfa_arg.accept, nfa_arg.start, acc);
       return nfa_make(s, acc);
     } else if (sym == optional_s) {
       /* In this case, we can keep the acceptance state of the inner
          NFA as the acceptance state of the new NFA. We simply add
          a new start state which can short-circuit to it via an empty
          transition.  */
-      nfa_t nfa_arg = nfa_compile_regex(first(args));
-      nfa_state_t *s = nfa_state_empty(nfa_arg.start, nfa_arg.accept);
+      nfa_frag_t nfa_arg = nfa_compile_regex(nfa, first(args));
+      int s = nfa_state_empty(nfa, nfa_arg.start, nfa_arg.accept);
       return nfa_make(s, nfa_arg.accept);
     } else if (sym == or_s) {
       /* Simple: make a new start and acceptance state, which form
          the ends of a spindle that goes through two branches. */
-      nfa_t nfa_first = nfa_compile_regex(first(args));
-      nfa_t nfa_second = nfa_compile_regex(second(args));
-      nfa_state_t *acc = nfa_state_accept();
+      nfa_frag_t nfa_first = nfa_compile_regex(nfa, first(args));
+      nfa_frag_t nfa_second = nfa_compile_regex(nfa, second(args));
+      int acc = nfa_state_accept(nfa);
       /* New state s has empty transitions into each inner NFA. */
-      nfa_state_t *s = nfa_state_empty(nfa_first.start, nfa_second.start);
+      int s = nfa_state_empty(nfa, nfa_first.start, nfa_second.start);
       /* Acceptance state of each inner NFA converted to empty
          transition to new combined acceptance state. */
-      nfa_state_empty_convert(nfa_first.accept, acc, 0);
-      nfa_state_empty_convert(nfa_second.accept, acc, 0);
+      nfa_state_empty_convert(nfa, nfa_first.accept, acc, NFA_NONE);
+      nfa_state_empty_convert(nfa, nfa_second.accept, acc, NFA_NONE);
       return nfa_make(s, acc);
     } else {
       internal_error("bad operator in regex");
@@ -1007,68 +1283,40 @@ static nfa_t nfa_compile_regex(val exp)
   }
 }
 
-static int nfa_all_states(nfa_state_t **inout, int num, unsigned visited)
+static void nfa_free(nfa_t *nfa)
 {
   int i;
 
-  for (i = 0; i < num; i++)
-    inout[i]->a.visited = visited;
-
-  for (i = 0; i < num; i++) {
-    nfa_state_t *s = inout[i];
-
-    if (num >= NFA_SET_SIZE)
-      internal_error("NFA set size exceeded");
-
-    switch (s->a.kind) {
-    case nfa_accept:
-      break;
-    case nfa_empty:
-      {
-        nfa_state_t *e0 = s->e.trans0;
-        nfa_state_t *e1 = s->e.trans1;
-
-        if (e0 && e0->a.visited != visited) {
-          e0->a.visited = visited;
-          inout[num++] = e0;
-        }
-        if (e1 && e1->a.visited != visited) {
-          e1->a.visited = visited;
-          inout[num++] = e1;
-        }
-      }
-      break;
-    case nfa_wild:
-    case nfa_single:
-    case nfa_set:
-      if (s->o.trans->a.visited != visited) {
-        s->o.trans->a.visited = visited;
-        inout[num++] = s->o.trans;
-      }
-      break;
-    }
-  }
-
-  if (num > NFA_SET_SIZE)
-    internal_error("NFA set size exceeded");
+  for (i = 0; i < nfa->nsets; i++)
+    char_set_destroy(nfa->sets[i]);
 
-  return num;
+  free(nfa->sets);
+  free(nfa->visited);
+  free(nfa->states);
 }
 
-static void nfa_free(nfa_t nfa)
+static void nfa_compile(nfa_t *nfa, val exp)
 {
-  nfa_state_t **all = (nfa_state_t **) chk_malloc(NFA_SET_SIZE * sizeof *all);
-  int nstates, i;
-
-  all[0] = nfa.start;
-  all[1] = nfa.accept;
+  static nfa_t blank;
+  nfa_frag_t frag;
 
-  nstates = nfa_all_states(all, 2, nfa.start->a.visited);
-
-  for (i = 0; i < nstates; i++)
-    nfa_state_free(all[i]);
+  *nfa = blank;
+  frag = nfa_compile_regex(nfa, exp);
+  nfa->start = frag.start;
+  nfa->accept = frag.accept;
+  nfa->visited = (unsigned *) chk_calloc(nfa->nstates, sizeof *nfa->visited);
+}
 
-  free(all);
+/*
+ * A fresh stamp for marking visited states.
+ */
+static unsigned nfa_stamp(nfa_t *nfa)
+{
+  if (++nfa->stamp == 0) {
+    memset(nfa->visited, 0, nfa->nstates * sizeof *nfa->visited);
+    nfa->stamp = 1;
+  }
+  return nfa->stamp;
 }
 
 /*
@@ -1076,8 +1324,9 @@ static void nfa_free(nfa_t nfa)
  * size is given by nin. The results are stored in the set out, the size of
  * which is returned. The stack parameter provides storage used by the
  * algorithm, so it doesn't have to be allocated and freed repeatedly.
- * The visited parameter is a stamp used for marking states which are added
- * to the epsilon-closure set, so that sets are not added twice.
+ * Each of these arrays has room for all of the states of the NFA.
+ * States added to the closure are marked with a fresh stamp, so that
+ * they are not added twice.
  * If any of the states added to the closure are acceptance states,
  * the accept parameter is used to store the flag 1.
  *
@@ -1085,58 +1334,56 @@ static void nfa_free(nfa_t nfa)
  * states which are reachable from that set with empty (epsilon) transitions.
  * (Transitions that don't do not consume and match an input character).
  */
-static int nfa_closure(nfa_state_t **stack, nfa_state_t **in, int nin,
-                       nfa_state_t **out, unsigned visited, int *accept)
+static int nfa_closure(nfa_t *nfa, int *stack, int *in, int nin,
+                       int *out, int *accept)
 {
   int i, nout = 0;
   int stackp = 0;
+  unsigned visited = nfa_stamp(nfa);
+  unsigned *vis = nfa->visited;
+  nfa_state_t *states = nfa->states;
 
   /* First, add all states in the input state to the closure,
      push them on the stack, and mark them as visited. */
   for (i = 0; i < nin; i++) {
-    if (stackp >= NFA_SET_SIZE)
-      internal_error("NFA set size exceeded");
-    in[i]->a.visited = visited;
-    stack[stackp++] = in[i];
-    out[nout++] = in[i];
-    if (in[i]->a.kind == nfa_accept)
+    int s = in[i];
+    if (vis[s] == visited)
+      continue;
+    vis[s] = visited;
+    stack[stackp++] = s;
+    out[nout++] = s;
+    if (states[s].kind == nfa_accept)
       *accept = 1;
   }
 
   while (stackp) {
-    nfa_state_t *top = stack[--stackp];
-
-    if (nout >= NFA_SET_SIZE)
-      internal_error("NFA set size exceeded");
+    nfa_state_t *top = &states[stack[--stackp]];
 
     /* Only states of type nfa_empty are interesting.
        Each such state at most two epsilon transitions. */
 
-    if (top->a.kind == nfa_empty) {
-      nfa_state_t *e0 = top->e.trans0;
-      nfa_state_t *e1 = top->e.trans1;
+    if (top->kind == nfa_empty) {
+      int e0 = top->trans0;
+      int e1 = top->trans1;
 
-      if (e0 && e0->a.visited != visited) {
-        e0->a.visited = visited;
+      if (e0 != NFA_NONE && vis[e0] != visited) {
+        vis[e0] = visited;
         stack[stackp++] = e0;
         out[nout++] = e0;
-        if (e0->a.kind == nfa_accept)
+        if (states[e0].kind == nfa_accept)
           *accept = 1;
       }
 
-      if (e1 && e1->a.visited != visited) {
-        e1->a.visited = visited;
+      if (e1 != NFA_NONE && vis[e1] != visited) {
+        vis[e1] = visited;
         stack[stackp++] = e1;
         out[nout++] = e1;
-        if (e1->a.kind == nfa_accept)
+        if (states[e1].kind == nfa_accept)
           *accept = 1;
       }
     }
   }
 
-  if (nout > NFA_SET_SIZE)
-    internal_error("NFA set size exceeded");
-
   return nout;
 }
 
@@ -1145,23 +1392,23 @@ static int nfa_closure(nfa_state_t **stack, nfa_state_t **in, int nin,
  * set is the set of states which are reachable from the set of
  * input states on the consumpion of the input character given by ch.
  */
-static int nfa_move(nfa_state_t **in, int nin, nfa_state_t **out, wchar_t ch)
+static int nfa_move(nfa_t *nfa, int *in, int nin, int *out, wchar_t ch)
 {
   int i, nmove;
 
   for (nmove = 0, i = 0; i < nin; i++) {
-    nfa_state_t *s = in[i];
+    nfa_state_t *s = &nfa->states[in[i]];
 
-    switch (s->a.kind) {
+    switch (s->kind) {
     case nfa_wild:
       /* Unconditional match; don't have to look at ch. */
       break;
     case nfa_single:
-      if (s->o.ch == ch) /* Character match. */
+      if (s->ch == ch) /* Character match. */
         break;
       continue; /* no match */
     case nfa_set:
-      if (char_set_contains(s->s.set, ch)) /* Set match. */
+      if (char_set_contains(nfa->sets[s->set], ch)) /* Set match. */
         break;
       continue; /* no match */
     default:
@@ -1169,124 +1416,411 @@ static int nfa_move(nfa_state_t **in, int nin, nfa_state_t **out, wchar_t ch)
       continue;
     }
 
-    /* The state matches the character, so add it to the move set.
-       C trick: all character-transitioning state types have the
-       pointer to the next state in the same position,
-       among a common set of leading struct members in the union. */
-
-    if (nmove >= NFA_SET_SIZE)
-      internal_error("NFA set size exceeded");
-    out[nmove++] = s->o.trans;
+    /* The state matches the character, so add its successor
+       to the move set. */
+    out[nmove++] = s->trans0;
   }
 
   return nmove;
 }
 
+static int dfa_set_cmp(const void *left, const void *right)
+{
+  int l = *(const int *) left;
+  int r = *(const int *) right;
+  return (l > r) - (l < r);
+}
+
 /*
- * Match regex against the string in. The match is
- * anchored to the front of the string; to search
- * within the string, a .* must be added to the front
- * of the regex.
- *
- * Returns the length of the prefix of the string
- * which matches the regex.  Or, if you will,
- * the position of the first mismatching
- * character.
- *
- * If the regex does not match at all, zero is
- * returned.
- *
- * Matching stops when a state is reached from which
- * there are no transitions on the next input character,
- * or when the string runs out of characters.
- * The most recently visited acceptance state then
- * determines the match length (defaulting to zero
- * if no acceptance states were encountered).
+ * Find the DFA state for the NFA state set, of size n, or make
+ * it. The set is sorted in place. Returns null if there is no such
+ * state and the DFA is full.
  */
-static cnum nfa_run(nfa_t nfa, const wchar_t *str)
-{
-  const wchar_t *last_accept_pos = 0, *ptr = str;
-  unsigned visited = nfa.start->a.visited + 1;
-  nfa_state_t **move = (nfa_state_t **) chk_malloc(NFA_SET_SIZE * sizeof *move);
-  nfa_state_t **clos = (nfa_state_t **) chk_malloc(NFA_SET_SIZE * sizeof *clos);
-  nfa_state_t **stack = (nfa_state_t **) chk_malloc(NFA_SET_SIZE * sizeof *stack);
-  int nmove = 1, nclos;
-  int accept = 0;
+static dfa_state_t *dfa_intern(dfa_t *dfa, int *set, int n, int accept)
+{
+  unsigned long hash = n;
+  dfa_state_t **bucket, *ds;
+  int i;
 
-  move[0] = nfa.start;
+  qsort(set, n, sizeof *set, dfa_set_cmp);
 
-  nclos = nfa_closure(stack, move, nmove, clos, visited++, &accept);
+  for (i = 0; i < n; i++)
+    hash = hash * 31 + set[i];
 
-  if (accept)
-    last_accept_pos = ptr;
+  bucket = &dfa->table[hash % DFA_HASH_SIZE];
+
+  for (ds = *bucket; ds != 0; ds = ds->next)
+    if (ds->hash == hash && ds->nstates == n &&
+        memcmp(ds->set, set, n * sizeof *set) == 0)
+      return ds;
+
+  if (dfa->count >= DFA_MAX_STATES)
+    return 0;
+
+  ds = (dfa_state_t *) chk_malloc(sizeof *ds +
+                                  (n > 1 ? n - 1 : 0) * sizeof *set);
+  ds->hash = hash;
+  ds->accept = accept;
+  ds->nstates = n;
+  memset(ds->trans, 0, sizeof ds->trans);
+  memset(ds->wide_trans, 0, sizeof ds->wide_trans);
+  memcpy(ds->set, set, n * sizeof *set);
+  ds->next = *bucket;
+  *bucket = ds;
+  dfa->count++;
+  return ds;
+}
 
-  for (; *ptr != 0; ptr++) {
-    wchar_t ch = *ptr;
+static dfa_t *dfa_create(nfa_t *nfa)
+{
+  dfa_t *dfa = (dfa_t *) chk_calloc(1, sizeof *dfa);
+  int accept = 0;
 
-    accept = 0;
+  dfa->move = (int *) chk_malloc(nfa->nstates * sizeof *dfa->move);
+  dfa->clos = (int *) chk_malloc(nfa->nstates * sizeof *dfa->clos);
+  dfa->stack = (int *) chk_malloc(nfa->nstates * sizeof *dfa->stack);
 
-    nmove = nfa_move(clos, nclos, move, ch);
-    nclos = nfa_closure(stack, move, nmove, clos, visited++, &accept);
+  dfa->move[0] = nfa->start;
+  dfa->nclos = nfa_closure(nfa, dfa->stack, dfa->move, 1, dfa->clos, &accept);
+  dfa->start = dfa_intern(dfa, dfa->clos, dfa->nclos, accept);
+  return dfa;
+}
 
-    if (accept)
-      last_accept_pos = ptr + 1;
+static void dfa_free(dfa_t *dfa)
+{
+  int i;
 
-    if (nclos == 0) /* dead end; no match */
-      break;
+  for (i = 0; i < DFA_HASH_SIZE; i++) {
+    dfa_state_t *ds = dfa->table[i], *next;
+    for (; ds != 0; ds = next) {
+      next = ds->next;
+      free(ds);
+    }
   }
 
-  nfa.start->a.visited = visited;
+  free(dfa->stack);
+  free(dfa->clos);
+  free(dfa->move);
+  free(dfa);
+}
 
-  free(stack);
-  free(clos);
-  free(move);
+/*
+ * The DFA state reached from ds on ch. If it is null, the DFA is full,
+ * and the NFA closure that the transition leads to is left in
+ * dfa->clos, dfa->nclos and dfa->accept.
+ */
+static dfa_state_t *dfa_step(nfa_t *nfa, dfa_t *dfa, dfa_state_t *ds,
+                             wchar_t ch)
+{
+  int cache = ((unsigned long) ch < DFA_CACHE_CHARS);
+  int slot = (unsigned long) ch % DFA_WIDE_CACHE;
+  dfa_state_t *next;
+  int nmove;
+
+  if (cache && (next = ds->trans[ch]) != 0)
+    return next;
 
-  return last_accept_pos ? last_accept_pos - str : -1;
+  if (!cache && (next = ds->wide_trans[slot]) != 0 && ds->wide_ch[slot] == ch)
+    return next;
+
+  nmove = nfa_move(nfa, ds->set, ds->nstates, dfa->move, ch);
+  dfa->accept = 0;
+  dfa->nclos = nfa_closure(nfa, dfa->stack, dfa->move, nmove, dfa->clos,
+                           &dfa->accept);
+
+  next = dfa_intern(dfa, dfa->clos, dfa->nclos, dfa->accept);
+
+  if (next && cache) {
+    ds->trans[ch] = next;
+  } else if (next) {
+    ds->wide_ch[slot] = ch;
+    ds->wide_trans[slot] = next;
+  }
+
+  return next;
 }
 
-static cnum regex_machine_match_span(regex_machine_t *regm)
+/*
+ * Number of positions in a regex, or -1 if the bit-parallel
+ * engine can't handle it.
+ */
+static int bp_count(val exp)
 {
-  return regm->n.last_accept_pos;
+  if (nullp(exp)) {
+    return 0;
+  } else if (chrp(exp) || exp == wild_s || exp == space_k ||
+             exp == digit_k || exp == word_char_k || exp == cspace_k ||
+             exp == cdigit_k || exp == cword_char_k) {
+    return 1;
+  } else if (stringp(exp)) {
+    return c_num(length_str(exp));
+  } else if (consp(exp)) {
+    val sym = first(exp), args = rest(exp);
+
+    if (sym == set_s || sym == cset_s) {
+      return 1;
+    } else if (sym == compound_s || sym == or_s || sym == zeroplus_s ||
+               sym == oneplus_s || sym == optional_s) {
+      int sum = 0;
+
+      for (; args; args = cdr(args)) {
+        int n = bp_count(car(args));
+        if (n < 0)
+          return -1;
+        sum += n;
+      }
+
+      return sum;
+    }
+  }
+
+  return -1;
 }
 
-static void regex_destroy(val regex)
+typedef struct bp_info {
+  int nullable;
+  bp_mask_t first, last;
+} bp_info_t;
+
+static bp_info_t bp_position(bp_t *bp, nfa_kind_t kind, wchar_t ch,
+                             char_set_t *set)
 {
-  nfa_t *pnfa = (nfa_t *) regex->co.handle;
-  nfa_free(*pnfa);
-  free(pnfa);
-  regex->co.handle = 0;
+  int p = bp->npos++;
+  bp_info_t ret;
+
+  bp->kind[p] = kind;
+  bp->ch[p] = ch;
+  bp->set[p] = set;
+  ret.nullable = 0;
+  ret.first = ret.last = BP_BIT(p);
+  return ret;
 }
 
-static struct cobj_ops regex_obj_ops = {
-  cobj_equal_op,
-  cobj_print_op,
-  regex_destroy,
-  cobj_mark_op,
-  cobj_hash_op
-};
+static void bp_add_follow(bp_mask_t *follow, bp_mask_t from, bp_mask_t to)
+{
+  int p;
 
-static val reg_nullable(val);
+  for (p = 0; from != 0; p++, from >>= 1)
+    if (from & 1)
+      follow[p] |= to;
+}
 
 /*
- * ``Compile'' raw regular expression to a form that is easier to simulate by
- * the derivative method.  Here we currently replace character set regexps with
- * character set objects, and also transform the nongreedy syntax into the more
- * complex expression it represents.
+ * Compute the first and last positions of exp, and whether it is
+ * nullable, adding its positions to bp and their follow sets to follow.
  */
-static val dv_compile_regex(val exp)
+static bp_info_t bp_build(bp_t *bp, bp_mask_t *follow, val exp)
 {
-  if (exp == space_k) {
-    return cobj((mem_t *) space_cs, chset_s, &char_set_obj_ops);
+  bp_info_t ret;
+
+  ret.nullable = 1;
+  ret.first = ret.last = 0;
+
+  if (nullp(exp)) {
+    return ret;
+  } else if (chrp(exp)) {
+    return bp_position(bp, nfa_single, c_chr(exp), 0);
+  } else if (stringp(exp)) {
+    return bp_build(bp, follow, cons(compound_s, list_str(exp)));
+  } else if (exp == wild_s) {
+    return bp_position(bp, nfa_wild, 0, 0);
+  } else if (exp == space_k) {
+    return bp_position(bp, nfa_set, 0, space_cs);
   } else if (exp == digit_k) {
-    return cobj((mem_t *) digit_cs, chset_s, &char_set_obj_ops);
+    return bp_position(bp, nfa_set, 0, digit_cs);
   } else if (exp == word_char_k) {
-    return cobj((mem_t *) word_cs, chset_s, &char_set_obj_ops);
+    return bp_position(bp, nfa_set, 0, word_cs);
   } else if (exp == cspace_k) {
-    return cobj((mem_t *) cspace_cs, chset_s, &char_set_obj_ops);
+    return bp_position(bp, nfa_set, 0, cspace_cs);
   } else if (exp == cdigit_k) {
-    return cobj((mem_t *) cdigit_cs, chset_s, &char_set_obj_ops);
+    return bp_position(bp, nfa_set, 0, cdigit_cs);
   } else if (exp == cword_char_k) {
-    return cobj((mem_t *) cword_cs, chset_s, &char_set_obj_ops);
+    return bp_position(bp, nfa_set, 0, cword_cs);
+  } else {
+    val sym = first(exp), args = rest(exp);
+
+    if (sym == set_s || sym == cset_s) {
+      return bp_position(bp, nfa_set, 0,
+                         char_set_compile(args, if2(sym == cset_s, t)));
+    } else if (sym == compound_s) {
+      for (; args; args = cdr(args)) {
+        bp_info_t arg = bp_build(bp, follow, car(args));
+        bp_add_follow(follow, ret.last, arg.first);
+        if (ret.nullable)
+          ret.first |= arg.first;
+        ret.last = if3(arg.nullable, ret.last | arg.last, arg.last);
+        ret.nullable = ret.nullable && arg.nullable;
+      }
+      return ret;
+    } else if (sym == or_s) {
+      bp_info_t arg0 = bp_build(bp, follow, first(args));
+      bp_info_t arg1 = bp_build(bp, follow, second(args));
+      ret.nullable = arg0.nullable || arg1.nullable;
+      ret.first = arg0.first | arg1.first;
+      ret.last = arg0.last | arg1.last;
+      return ret;
+    } else {
+      ret = bp_build(bp, follow, first(args));
+      if (sym != optional_s)
+        bp_add_follow(follow, ret.last, ret.first);
+      if (sym != oneplus_s)
+        ret.nullable = 1;
+      return ret;
+    }
+  }
+}
+
+static int bp_match(bp_t *bp, int p, wchar_t ch)
+{
+  switch (bp->kind[p]) {
+  case nfa_wild:
+    return 1;
+  case nfa_single:
+    return bp->ch[p] == ch;
+  case nfa_set:
+    return char_set_contains(bp->set[p], ch);
+  default:
+    return 0;
+  }
+}
+
+/*
+ * Make the bit-parallel automaton for a regex, or return null
+ * if it has too many positions.
+ */
+static bp_t *bp_compile(val exp)
+{
+  int npos = bp_count(exp), nchunks, k, v, p;
+  bp_mask_t follow[BP_MAX_POS];
+  bp_info_t root;
+  bp_t *bp;
+
+  if (npos < 0 || npos >= BP_MAX_POS)
+    return 0;
+
+  bp = (bp_t *) chk_calloc(1, sizeof *bp);
+  memset(follow, 0, sizeof follow);
+
+  bp->npos = 1;
+  bp->kind[0] = nfa_accept;
+  root = bp_build(bp, follow, exp);
+  follow[0] = root.first;
+  bp->last = root.last | if3(root.nullable, BP_BIT(0), 0);
+
+  nchunks = (bp->npos + BP_CHUNK_BITS - 1) / BP_CHUNK_BITS;
+  bp->follow = (bp_mask_t *) chk_malloc(nchunks * BP_CHUNK_SIZE *
+                                        sizeof *bp->follow);
+
+  for (k = 0; k < nchunks; k++) {
+    bp_mask_t *tab = bp->follow + k * BP_CHUNK_SIZE;
+    tab[0] = 0;
+    for (v = 1; v < BP_CHUNK_SIZE; v++) {
+      int low = 0;
+      while (!(v & (1 << low)))
+        low++;
+      p = k * BP_CHUNK_BITS + low;
+      tab[v] = tab[v & (v - 1)] | if3(p < bp->npos, follow[p], 0);
+    }
+  }
+
+  for (v = 0; v < BP_CACHE_CHARS; v++)
+    for (p = 1; p < bp->npos; p++)
+      if (bp_match(bp, p, v))
+        bp->cmask[v] |= BP_BIT(p);
+
+  return bp;
+}
+
+static void bp_free(bp_t *bp)
+{
+  int p;
+
+  for (p = 1; p < bp->npos; p++)
+    if (bp->kind[p] == nfa_set)
+      char_set_destroy(bp->set[p]);
+
+  free(bp->follow);
+  free(bp);
+}
+
+static bp_mask_t bp_step(bp_t *bp, bp_mask_t d, wchar_t ch)
+{
+  bp_mask_t reach = 0, *tab = bp->follow;
+
+  for (; d != 0; d >>= BP_CHUNK_BITS, tab += BP_CHUNK_SIZE)
+    reach |= tab[d & (BP_CHUNK_SIZE - 1)];
+
+  if ((unsigned long) ch < BP_CACHE_CHARS) {
+    return reach & bp->cmask[ch];
+  } else {
+    bp_mask_t next = 0;
+    int p;
+
+    for (p = 1; p < bp->npos; p++)
+      if ((reach & BP_BIT(p)) && bp_match(bp, p, ch))
+        next |= BP_BIT(p);
+
+    return next;
+  }
+}
+
+static cnum regex_machine_match_span(regex_machine_t *regm)
+{
+  return regm->n.last_accept_pos;
+}
+
+static void regex_destroy(val regex)
+{
+  nfa_regex_t *preg = (nfa_regex_t *) regex->co.handle;
+  if (preg->bp) {
+    bp_free(preg->bp);
+  } else {
+    nfa_free(&preg->nfa);
+    if (preg->dfa)
+      dfa_free(preg->dfa);
+  }
+  free(preg);
+  regex->co.handle = 0;
+}
+
+static void regex_mark(val regex)
+{
+  nfa_regex_t *preg = (nfa_regex_t *) regex->co.handle;
+  gc_mark(preg->source);
+  gc_mark(preg->reverse);
+  gc_mark(preg->literals);
+}
+
+static struct cobj_ops regex_obj_ops = {
+  cobj_equal_op,
+  cobj_print_op,
+  regex_destroy,
+  regex_mark,
+  cobj_hash_op
+};
+
+static val reg_nullable(val);
+
+/*
+ * ``Compile'' raw regular expression to a form that is easier to simulate by
+ * the derivative method.  Here we currently replace character set regexps with
+ * character set objects, and also transform the nongreedy syntax into the more
+ * complex expression it represents.
+ */
+static val dv_compile_regex(val exp)
+{
+  if (exp == space_k) {
+    return cobj((mem_t *) space_cs, chset_s, &char_set_obj_ops);
+  } else if (exp == digit_k) {
+    return cobj((mem_t *) digit_cs, chset_s, &char_set_obj_ops);
+  } else if (exp == word_char_k) {
+    return cobj((mem_t *) word_cs, chset_s, &char_set_obj_ops);
+  } else if (exp == cspace_k) {
+    return cobj((mem_t *) cspace_cs, chset_s, &char_set_obj_ops);
+  } else if (exp == cdigit_k) {
+    return cobj((mem_t *) cdigit_cs, chset_s, &char_set_obj_ops);
+  } else if (exp == cword_char_k) {
+    return cobj((mem_t *) cword_cs, chset_s, &char_set_obj_ops);
   } else if (symbolp(exp) || chrp(exp)) {
     return exp;
   } else if (stringp(exp)) {
@@ -1563,25 +2097,184 @@ static val reg_derivative(val exp, val ch)
   }
 }
 
-static cnum dv_run(val regex, const wchar_t *str)
+/*
+ * Normalize a derivative term, so that terms which are equal up to
+ * associativity and idempotence of or, and the identities of the empty
+ * regex and the empty set, are the same term: nested or and compound
+ * forms are flattened, and failing, empty and duplicate elements are
+ * dropped. Under this normalization, the derivatives of any regex
+ * come to a finite number of distinct terms.
+ */
+static val dv_normalize(val exp)
 {
-  const wchar_t *last_accept_pos = 0, *ptr = str;
+  val sym, args;
+
+  if (atom(exp))
+    return exp;
+
+  sym = first(exp);
+  args = rest(exp);
+
+  if (sym == or_s) {
+    list_collect_decl (out, ptail);
+
+    for (args = flatten_or(exp); args; args = cdr(args)) {
+      val norm = dv_normalize(car(args));
+      if (norm != t && !memqual(norm, out))
+        list_collect (ptail, norm);
+    }
+
+    if (!out)
+      return t;
+    return unflatten_or(out);
+  } else if (sym == compound_s) {
+    list_collect_decl (out, ptail);
+
+    for (; args; args = cdr(args)) {
+      val norm = dv_normalize(car(args));
+      if (norm == t)
+        return t;
+      if (consp(norm) && car(norm) == compound_s)
+        list_collect_append (ptail, cdr(norm));
+      else if (norm != nil)
+        list_collect (ptail, norm);
+    }
+
+    if (!out)
+      return nil;
+    if (!cdr(out))
+      return car(out);
+    return cons(compound_s, out);
+  } else if (sym == and_s) {
+    val left = dv_normalize(first(args));
+    val right = dv_normalize(second(args));
+    if (left == t || right == t)
+      return t;
+    if (equal(left, right))
+      return left;
+    return list(and_s, left, right, nao);
+  } else if (sym == zeroplus_s || sym == oneplus_s ||
+             sym == optional_s || sym == compl_s) {
+    return list(sym, dv_normalize(first(args)), nao);
+  }
+
+  return exp;
+}
 
-  for (; *ptr != 0; ptr++) {
-    wchar_t ch = *ptr;
-    val nullable = reg_nullable(regex);
-    val deriv = reg_derivative(regex, chr(ch));
+/*
+ * Derivative states. Each normalized derivative term of a regex gets a
+ * state vector, holding the term, its nullability, and its transitions,
+ * which are filled in as they are taken: a vector indexed by character
+ * for Latin-1, and a hash table for the rest. The states are found in
+ * an equal-based hash table, the memo. Past DV_MAX_STATES, new states
+ * are not entered in the memo, and do not cache transitions, so a
+ * pathological regex is run by recalculating derivatives, as before.
+ */
+#define DV_MAX_STATES 512
 
-    if (nullable)
-      last_accept_pos = ptr;
+enum dv_state { dv_term, dv_nullable, dv_trans, dv_trans_hash, dv_state_size };
 
-    if (deriv == t)
-      return last_accept_pos ? last_accept_pos - str : -1;
+static val dv_state(val memo, val term)
+{
+  val st = gethash(memo, term);
+
+  if (!st) {
+    st = vector(num(dv_state_size));
+    set(st->v.vec[dv_term], term);
+    set(st->v.vec[dv_nullable], reg_nullable(term));
+    if (c_num(hash_count(memo)) < DV_MAX_STATES) {
+      set(st->v.vec[dv_trans], vector(num(DFA_CACHE_CHARS)));
+      sethash(memo, term, st);
+    }
   }
 
-  if (reg_nullable(regex))
-    return ptr - str;
-  return last_accept_pos ? last_accept_pos - str : -1;
+  return st;
+}
+
+static val dv_step(val memo, val st, wchar_t ch)
+{
+  val *vec = st->v.vec;
+  val trans = vec[dv_trans];
+  int latin1 = ((unsigned long) ch < DFA_CACHE_CHARS);
+  val next;
+
+  if (trans) {
+    if (latin1)
+      next = trans->v.vec[ch];
+    else
+      next = if2(vec[dv_trans_hash], gethash(vec[dv_trans_hash], chr(ch)));
+    if (next)
+      return next;
+  }
+
+  next = dv_state(memo, dv_normalize(reg_derivative(vec[dv_term], chr(ch))));
+
+  if (trans) {
+    if (latin1) {
+      set(trans->v.vec[ch], next);
+    } else {
+      if (!vec[dv_trans_hash])
+        set(vec[dv_trans_hash], make_hash(nil, nil, nil));
+      sethash(vec[dv_trans_hash], chr(ch), next);
+    }
+  }
+
+  return next;
+}
+
+/*
+ * A regex run by derivatives is compiled to the list
+ * (sys:compiled-regex term dv), where dv is an object holding the memo
+ * and start state, the reverse regex and the literals. The states refer
+ * to each other in cycles, so they are kept out of the list, which can
+ * then be printed.
+ */
+typedef struct dv_regex {
+  val memo;
+  val start;
+  val reverse;
+  val literals;
+} dv_regex_t;
+
+static val dv_regex_s;
+
+static void dv_regex_destroy(val obj)
+{
+  free(obj->co.handle);
+  obj->co.handle = 0;
+}
+
+static void dv_regex_mark(val obj)
+{
+  dv_regex_t *dv = (dv_regex_t *) obj->co.handle;
+  gc_mark(dv->memo);
+  gc_mark(dv->start);
+  gc_mark(dv->reverse);
+  gc_mark(dv->literals);
+}
+
+static struct cobj_ops dv_regex_ops = {
+  cobj_equal_op,
+  cobj_print_op,
+  dv_regex_destroy,
+  dv_regex_mark,
+  cobj_hash_op
+};
+
+static val dv_regex_compile(val term, val literals)
+{
+  dv_regex_t *dv = (dv_regex_t *) chk_calloc(1, sizeof *dv);
+  val obj = cobj((mem_t *) dv, dv_regex_s, &dv_regex_ops);
+  dv->literals = literals;
+  dv->memo = make_hash(nil, nil, t);
+  dv->start = dv_state(dv->memo, term);
+  mut(obj);
+  return list(compiled_regex_s, term, obj, nao);
+}
+
+static dv_regex_t *dv_regex(val regex)
+{
+  return (dv_regex_t *) cobj_handle(third(regex), dv_regex_s);
 }
 
 static val regex_requires_dv(val exp)
@@ -1612,15 +2305,180 @@ static val regex_requires_dv(val exp)
   }
 }
 
-val regex_compile(val regex_sexp)
+/*
+ * Reverse a regex: the result matches the reverse of every string
+ * which the argument matches. This works on source syntax without
+ * the nongreedy operator, and on compiled derivative terms.
+ */
+static val reg_reverse(val exp)
+{
+  if (stringp(exp)) {
+    return cons(compound_s, reverse(list_str(exp)));
+  } else if (consp(exp)) {
+    val sym = first(exp), args = rest(exp);
+
+    if (sym == set_s || sym == cset_s) {
+      return exp;
+    } else if (sym == compound_s) {
+      return cons(compound_s, reverse(mapcar(func_n1(reg_reverse), args)));
+    } else if (sym == zeroplus_s || sym == oneplus_s ||
+               sym == optional_s || sym == compl_s ||
+               sym == or_s || sym == and_s) {
+      return cons(sym, mapcar(func_n1(reg_reverse), args));
+    } else {
+      internal_error("bad operator in regex");
+    }
+  }
+
+  return exp;
+}
+
+/*
+ * Find literal text in a regex, for quickly skipping to places where a
+ * match is possible. Returns a string with which every match of exp
+ * begins, and stores into *pexact whether exp matches only that string.
+ * The longest string known to occur in every match is stored into *pmust.
+ */
+static val reg_literals(val exp, val *pexact, val *pmust)
+{
+  *pexact = nil;
+  *pmust = null_string;
+
+  if (nullp(exp)) {
+    *pexact = t;
+    return null_string;
+  } else if (chrp(exp)) {
+    *pexact = t;
+    return *pmust = cat_str(cons(exp, nil), nil);
+  } else if (stringp(exp)) {
+    *pexact = t;
+    return *pmust = exp;
+  } else if (consp(exp)) {
+    val sym = first(exp), args = rest(exp);
+
+    if (sym == compound_s) {
+      val prefix = null_string, run = null_string;
+
+      *pexact = t;
+
+      for (; args; args = cdr(args)) {
+        val exact, must, pre = reg_literals(car(args), &exact, &must);
+
+        if (length_str_gt(must, length_str(*pmust)))
+          *pmust = must;
+
+        run = cat_str(list(run, pre, nao), nil);
+
+        if (*pexact)
+          prefix = run;
+
+        if (length_str_gt(run, length_str(*pmust)))
+          *pmust = run;
+
+        if (!exact) {
+          *pexact = nil;
+          run = null_string;
+        }
+      }
+
+      return prefix;
+    } else if (sym == oneplus_s) {
+      val exact;
+      return reg_literals(first(args), &exact, pmust);
+    }
+  }
+
+  return null_string;
+}
+
+/*
+ * The literals of a regex: a cons of the prefix and the required
+ * string, as found by reg_literals; nil if there are none.
+ */
+static val regex_make_literals(val regex_sexp)
+{
+  val exact, must, prefix = reg_literals(regex_sexp, &exact, &must);
+
+  if (length_str_gt(must, zero))
+    return cons(prefix, must);
+  return nil;
+}
+
+static val regex_compile_uncached(val regex_sexp)
 {
   if (opt_derivative_regex || regex_requires_dv(regex_sexp)) {
-    return cons(compiled_regex_s, cons(dv_compile_regex(regex_sexp), nil));
+    val term = dv_normalize(dv_compile_regex(regex_sexp));
+    return dv_regex_compile(term, regex_make_literals(regex_sexp));
   } else {
-    nfa_t *pnfa = (nfa_t *) chk_malloc(sizeof *pnfa);
-    *pnfa = nfa_compile_regex(regex_sexp);
-    return cobj((mem_t *) pnfa, regex_s, &regex_obj_ops);
+    nfa_regex_t *preg = (nfa_regex_t *) chk_calloc(1, sizeof *preg);
+    val regex;
+    if ((preg->bp = bp_compile(regex_sexp)) == 0) {
+      nfa_compile(&preg->nfa, regex_sexp);
+      preg->dfa = dfa_create(&preg->nfa);
+    }
+    /* The object must exist before preg refers to anything,
+       so that the garbage collector can see those references. */
+    regex = cobj((mem_t *) preg, regex_s, &regex_obj_ops);
+    preg->source = regex_sexp;
+    preg->literals = regex_make_literals(regex_sexp);
+    mut(regex);
+    return regex;
+  }
+}
+
+#define REGEX_CACHE_MAX 512
+
+/*
+ * Cache of compiled regexes, keyed on a copy of their source, so that
+ * compiling the same syntax again costs only a hash lookup. When the
+ * cache fills up, it is simply emptied.
+ */
+static val regex_cache;
+static cnum regex_cache_hits, regex_cache_misses, regex_cache_flushes;
+
+static val reg_copy(val exp)
+{
+  if (consp(exp))
+    return cons(reg_copy(car(exp)), reg_copy(cdr(exp)));
+  else if (stringp(exp))
+    return copy_str(exp);
+  return exp;
+}
+
+val regex_compile(val regex_sexp)
+{
+  val key = cons(if2(opt_derivative_regex, t), regex_sexp);
+  val found, regex = gethash_f(regex_cache, key, &found);
+
+  if (found) {
+    regex_cache_hits++;
+    return regex;
+  }
+
+  regex_cache_misses++;
+  regex_sexp = reg_copy(regex_sexp);
+  regex = regex_compile_uncached(regex_sexp);
+
+  if (c_num(hash_count(regex_cache)) >= REGEX_CACHE_MAX) {
+    regex_cache = make_hash(nil, nil, t);
+    regex_cache_flushes++;
   }
+
+  sethash(regex_cache, cons(car(key), regex_sexp), regex);
+  return regex;
+}
+
+val regex_cache_stats(void)
+{
+  return list(cons(intern(lit("hits"), keyword_package),
+                   num(regex_cache_hits)),
+              cons(intern(lit("misses"), keyword_package),
+                   num(regex_cache_misses)),
+              cons(intern(lit("flushes"), keyword_package),
+                   num(regex_cache_flushes)),
+              cons(intern(lit("count"), keyword_package),
+                   hash_count(regex_cache)),
+              nao);
 }
 
 val regexp(val obj)
@@ -1631,18 +2489,12 @@ val regexp(val obj)
   return typeof(obj) == regex_s ? t : nil;
 }
 
-static nfa_t *regex_nfa(val reg)
+static nfa_regex_t *regex_nfa(val reg)
 {
   assert (typeof(reg) == regex_s);
-  return (nfa_t *) reg->co.handle;
+  return (nfa_regex_t *) reg->co.handle;
 }
 
-static cnum regex_run(val compiled_regex, const wchar_t *str)
-{
-  if (consp(compiled_regex))
-    return dv_run(compiled_regex, str);
-  return nfa_run(*regex_nfa(compiled_regex), str);
-}
 
 /*
  * Regex machine: represents the logic of the regex_run function as state
@@ -1656,17 +2508,17 @@ static void regex_machine_reset(regex_machine_t *regm)
   regm->n.last_accept_pos = -1;
   regm->n.count = 0;
 
-  if (regm->n.is_nfa) {
-    regm->n.visited = regm->n.nfa.start->a.visited + 1;
-    regm->n.nmove = 1;
-
-    regm->n.move[0] = regm->n.nfa.start;
-
-    regm->n.nclos = nfa_closure(regm->n.stack, regm->n.move, regm->n.nmove,
-                                regm->n.clos, regm->n.visited++, &accept);
+  if (regm->n.is_nfa && regm->n.bp) {
+    regm->n.bstate = BP_BIT(0);
+    regm->n.nclos = 1;
+    accept = ((regm->n.bp->last & BP_BIT(0)) != 0);
+  } else if (regm->n.is_nfa) {
+    regm->n.dstate = regm->n.dfa->start;
+    regm->n.nclos = regm->n.dstate->nstates;
+    accept = regm->n.dstate->accept;
   } else {
-    regm->d.deriv = regm->d.regex;
-    accept = (reg_nullable(regm->d.regex) != nil);
+    regm->d.deriv = dv_regex(regm->d.regex)->start;
+    accept = (regm->d.deriv->v.vec[dv_nullable] != nil);
   }
 
   if (accept)
@@ -1678,15 +2530,16 @@ static void regex_machine_init(regex_machine_t *regm, val regex)
   if (consp(regex)) {
     regm->n.is_nfa = 0;
     regm->d.regex = regex;
+    regm->d.memo = dv_regex(regex)->memo;
   } else {
+    nfa_regex_t *preg = regex_nfa(regex);
     regm->n.is_nfa = 1;
-    regm->n.nfa = *regex_nfa(regex);
-    regm->n.move = (nfa_state_t **)
-                     chk_malloc(NFA_SET_SIZE * sizeof *regm->n.move);
-    regm->n.clos = (nfa_state_t **)
-                     chk_malloc(NFA_SET_SIZE * sizeof *regm->n.clos);
-    regm->n.stack = (nfa_state_t **)
-                      chk_malloc(NFA_SET_SIZE * sizeof *regm->n.stack);
+    regm->n.nfa = &preg->nfa;
+    regm->n.dfa = preg->dfa;
+    regm->n.bp = preg->bp;
+    regm->n.move = 0;
+    regm->n.clos = 0;
+    regm->n.stack = 0;
   }
 
   regex_machine_reset(regm);
@@ -1701,11 +2554,33 @@ static void regex_machine_cleanup(regex_machine_t *regm)
     regm->n.stack = 0;
     regm->n.clos = 0;
     regm->n.move = 0;
-    regm->n.nfa.start = 0;
-    regm->n.nfa.accept = 0;
+    regm->n.nfa = 0;
+    regm->n.dfa = 0;
+    regm->n.dstate = 0;
+    regm->n.bp = 0;
   }
 }
 
+/*
+ * The DFA is full: continue from its closure by simulating the NFA.
+ */
+static int regex_machine_fall_back(regex_machine_t *regm)
+{
+  dfa_t *dfa = regm->n.dfa;
+  int nstates = regm->n.nfa->nstates;
+
+  if (!regm->n.move) {
+    regm->n.move = (int *) chk_malloc(nstates * sizeof *regm->n.move);
+    regm->n.clos = (int *) chk_malloc(nstates * sizeof *regm->n.clos);
+    regm->n.stack = (int *) chk_malloc(nstates * sizeof *regm->n.stack);
+  }
+
+  memcpy(regm->n.clos, dfa->clos, dfa->nclos * sizeof *dfa->clos);
+  regm->n.nclos = dfa->nclos;
+  regm->n.dstate = 0;
+  return dfa->accept;
+}
+
 static regm_result_t regex_machine_feed(regex_machine_t *regm, wchar_t ch)
 {
   int accept = 0;
@@ -1714,17 +2589,31 @@ static regm_result_t regex_machine_feed(regex_machine_t *regm, wchar_t ch)
     if (ch != 0) {
       regm->n.count++;
 
-      regm->n.nmove = nfa_move(regm->n.clos, regm->n.nclos, regm->n.move, ch);
-      regm->n.nclos = nfa_closure(regm->n.stack, regm->n.move,
-                                  regm->n.nmove, regm->n.clos,
-                                  regm->n.visited++, &accept);
+      if (regm->n.bp) {
+        regm->n.bstate = bp_step(regm->n.bp, regm->n.bstate, ch);
+        regm->n.nclos = (regm->n.bstate != 0);
+        accept = ((regm->n.bstate & regm->n.bp->last) != 0);
+      } else if (regm->n.dstate) {
+        dfa_state_t *next = dfa_step(regm->n.nfa, regm->n.dfa,
+                                     regm->n.dstate, ch);
+        if (next) {
+          regm->n.dstate = next;
+          regm->n.nclos = next->nstates;
+          accept = next->accept;
+        } else {
+          accept = regex_machine_fall_back(regm);
+        }
+      } else {
+        regm->n.nmove = nfa_move(regm->n.nfa, regm->n.clos, regm->n.nclos,
+                                 regm->n.move, ch);
+        regm->n.nclos = nfa_closure(regm->n.nfa, regm->n.stack, regm->n.move,
+                                    regm->n.nmove, regm->n.clos, &accept);
+      }
 
       if (accept)
         regm->n.last_accept_pos = regm->n.count;
     }
 
-    regm->n.nfa.start->a.visited = regm->n.visited;
-
     if (ch && regm->n.nclos != 0) {
       if (accept)
          return REGM_MATCH;
@@ -1735,12 +2624,12 @@ static regm_result_t regex_machine_feed(regex_machine_t *regm, wchar_t ch)
 
     if (ch != 0) {
       regm->d.count++;
-      regm->d.deriv = reg_derivative(regm->d.deriv, chr(ch));
-      if ((accept = reg_nullable(regm->d.deriv)))
+      regm->d.deriv = dv_step(regm->d.memo, regm->d.deriv, ch);
+      if ((accept = regm->d.deriv->v.vec[dv_nullable]))
         regm->d.last_accept_pos = regm->d.count;
     }
 
-    if (ch && regm->d.deriv != t) {
+    if (ch && regm->d.deriv->v.vec[dv_term] != t) {
       if (accept)
          return REGM_MATCH;
       return REGM_INCOMPLETE;
@@ -1757,6 +2646,595 @@ static regm_result_t regex_machine_feed(regex_machine_t *regm, wchar_t ch)
   return REGM_INCOMPLETE;
 }
 
+static int regex_machine_dead(regex_machine_t *regm)
+{
+  if (regm->n.is_nfa)
+    return regm->n.nclos == 0;
+  return regm->d.deriv->v.vec[dv_term] == t;
+}
+
+/*
+ * The characters of a string which is being matched. A narrow string
+ * is read a byte at a time, so that it need not be widened by c_str.
+ */
+typedef struct regex_text {
+  const wchar_t *wide;
+  const unsigned char *narrow;
+} regex_text_t;
+
+static void regex_text_init(regex_text_t *txt, val str)
+{
+  if (is_narrow_str(str)) {
+    txt->wide = 0;
+    txt->narrow = narrow_ptr(str);
+  } else {
+    txt->wide = c_str(str);
+    txt->narrow = 0;
+  }
+}
+
+#define regex_text_ref(txt, i) \
+  ((txt)->narrow ? (wchar_t) (txt)->narrow[i] : (txt)->wide[i])
+
+/*
+ * Position of the first occurrence of the literal lit in the text at
+ * or after pos, or -1 if there is none.
+ */
+static cnum regex_text_find(regex_text_t *txt, cnum pos, const wchar_t *lit)
+{
+  if (txt->wide) {
+    const wchar_t *next = if3(lit[1], wcsstr(txt->wide + pos, lit),
+                              wcschr(txt->wide + pos, lit[0]));
+    return if3(next, next - txt->wide, -1);
+  } else {
+    const char *h = (const char *) txt->narrow;
+
+    if (lit[0] < 1 || lit[0] > 255)
+      return -1;
+
+    for (;; pos++) {
+      const char *next = strchr(h + pos, lit[0]);
+      cnum j;
+
+      if (!next)
+        return -1;
+
+      pos = next - h;
+
+      for (j = 1; lit[j] && txt->narrow[pos + j] == lit[j]; j++)
+        ;
+
+      if (!lit[j])
+        return pos;
+    }
+  }
+}
+
+/*
+ * Match regex against the text, starting at pos. The match is
+ * anchored to that position; to search
+ * within the string, a .* must be added to the front
+ * of the regex.
+ *
+ * Returns the length of the prefix of the text
+ * which matches the regex, or -1 if the regex does
+ * not match at all.
+ *
+ * Matching stops when a state is reached from which
+ * there are no transitions on the next input character,
+ * or when the string runs out of characters.
+ * The most recently visited acceptance state then
+ * determines the match length.
+ */
+static cnum regex_run(val regex, regex_text_t *txt, cnum pos)
+{
+  regex_machine_t regm;
+  cnum span;
+  wchar_t ch;
+
+  regex_machine_init(&regm, regex);
+
+  for (; (ch = regex_text_ref(txt, pos)) != 0 && !regex_machine_dead(&regm);
+       pos++)
+    regex_machine_feed(&regm, ch);
+
+  span = regm.n.last_accept_pos;
+  regex_machine_cleanup(&regm);
+  return span;
+}
+
+/*
+ * A regex set: the NFA's of several regexes, each of which keeps its own
+ * acceptance state, tagged with the index of the regex, joined together
+ * by a chain of empty transitions from a new start state. One pass over
+ * a string finds which of them match a prefix of it.
+ */
+static val regex_set_s;
+
+val regex_set_compile(val regexes)
+{
+  int n = c_num(length(regexes)), i, next = NFA_NONE;
+  int *starts;
+  val iter, set;
+  nfa_regex_t *preg;
+  nfa_t *nfa;
+  list_collect_decl (sources, ptail);
+
+  if (n == 0)
+    return nil;
+
+  for (iter = regexes; iter; iter = cdr(iter)) {
+    if (consp(car(iter)))
+      return nil;
+    list_collect (ptail, regex_nfa(car(iter))->source);
+  }
+
+  preg = (nfa_regex_t *) chk_calloc(1, sizeof *preg);
+  nfa = &preg->nfa;
+  starts = (int *) chk_malloc(n * sizeof *starts);
+
+  for (i = 0, iter = sources; iter; i++, iter = cdr(iter)) {
+    nfa_frag_t frag = nfa_compile_regex(nfa, car(iter));
+    nfa->states[frag.accept].set = i;
+    starts[i] = frag.start;
+  }
+
+  while (i-- > 0)
+    next = nfa_state_empty(nfa, starts[i], next);
+
+  free(starts);
+  nfa->start = next;
+  nfa->accept = NFA_NONE;
+  nfa->visited = (unsigned *) chk_calloc(nfa->nstates, sizeof *nfa->visited);
+  preg->dfa = dfa_create(nfa);
+  preg->nregex = n;
+  set = cobj((mem_t *) preg, regex_set_s, &regex_obj_ops);
+  preg->source = sources;
+  mut(set);
+  return set;
+}
+
+/*
+ * Returns the list of the indices of the regexes in the set which
+ * match at pos in str, in increasing order.
+ */
+val regex_set_match(val set, val str, val pos)
+{
+  nfa_regex_t *preg = (nfa_regex_t *) cobj_handle(set, regex_set_s);
+  nfa_t *nfa = &preg->nfa;
+  dfa_t *dfa = preg->dfa;
+  dfa_state_t *ds = dfa->start;
+  int *states = ds->set, nstates = ds->nstates, accept = ds->accept;
+  int *move = 0, *clos = 0, *stack = 0;
+  char *hit = (char *) chk_calloc(preg->nregex, 1);
+  int i, nhit = 0;
+  val result = nil;
+
+  if (!pos)
+    pos = zero;
+
+  for (;;) {
+    wchar_t ch;
+
+    if (accept) {
+      for (i = 0; i < nstates; i++) {
+        nfa_state_t *st = &nfa->states[states[i]];
+        if (st->kind == nfa_accept && !hit[st->set]) {
+          hit[st->set] = 1;
+          nhit++;
+        }
+      }
+    }
+
+    if (nstates == 0 || nhit == preg->nregex || !length_str_gt(str, pos))
+      break;
+
+    ch = c_chr(chr_str(str, pos));
+    pos = plus(pos, one);
+
+    if (ds) {
+      if ((ds = dfa_step(nfa, dfa, ds, ch)) != 0) {
+        states = ds->set;
+        nstates = ds->nstates;
+        accept = ds->accept;
+        continue;
+      }
+
+      move = (int *) chk_malloc(nfa->nstates * sizeof *move);
+      clos = (int *) chk_malloc(nfa->nstates * sizeof *clos);
+      stack = (int *) chk_malloc(nfa->nstates * sizeof *stack);
+      memcpy(clos, dfa->clos, dfa->nclos * sizeof *clos);
+      states = clos;
+      nstates = dfa->nclos;
+      accept = dfa->accept;
+    } else {
+      int nmove = nfa_move(nfa, clos, nstates, move, ch);
+      accept = 0;
+      nstates = nfa_closure(nfa, stack, move, nmove, clos, &accept);
+    }
+  }
+
+  for (i = preg->nregex - 1; i >= 0; i--)
+    if (hit[i])
+      result = cons(num(i), result);
+
+  free(stack);
+  free(clos);
+  free(move);
+  free(hit);
+  return result;
+}
+
+/*
+ * Matching a sequence of regexes in one pass, finding where each of
+ * them matches. The NFA's of the regexes are chained together, with
+ * nfa_tag states around each one, which record the position at which
+ * they are passed. The NFA is simulated with a list of threads in order
+ * of priority, each having its own record of tag positions. When two
+ * threads reach the same state, the one of lower priority is dropped.
+ * The first transition out of a state has priority over the second,
+ * so repetition is greedy. The longest match wins, and at the end of
+ * it, the thread of highest priority supplies the positions.
+ */
+static val regex_groups_s;
+static val regex_groups_cache;
+
+static val regex_groups_compile(val regexes)
+{
+  int n = c_num(length(regexes)), i;
+  int next;
+  val iter, sources = nil, groups;
+  nfa_regex_t *preg;
+  nfa_t *nfa;
+
+  for (iter = regexes; iter; iter = cdr(iter)) {
+    val regex = car(iter);
+    if (consp(regex) || !regexp(regex))
+      uw_throwf(error_s, lit("match-regex-groups: ~s not supported"),
+                regex, nao);
+    push(regex_nfa(regex)->source, &sources);
+  }
+
+  preg = (nfa_regex_t *) chk_calloc(1, sizeof *preg);
+  nfa = &preg->nfa;
+  next = nfa_state_accept(nfa);
+  nfa->accept = next;
+
+  for (i = n - 1, iter = sources; iter; i--, iter = cdr(iter)) {
+    nfa_frag_t frag = nfa_compile_regex(nfa, car(iter));
+    nfa_state_t *close = &nfa->states[frag.accept];
+    close->kind = nfa_tag;
+    close->trans0 = next;
+    close->set = 2 * i + 1;
+    next = nfa_state_new(nfa, nfa_tag, frag.start, NFA_NONE);
+    nfa->states[next].set = 2 * i;
+  }
+
+  nfa->start = next;
+  nfa->visited = (unsigned *) chk_calloc(nfa->nstates, sizeof *nfa->visited);
+  preg->nregex = n;
+  groups = cobj((mem_t *) preg, regex_groups_s, &regex_obj_ops);
+  preg->source = reverse(sources);
+  mut(groups);
+  return groups;
+}
+
+typedef struct regex_threads {
+  int n;
+  int *state;
+  cnum *tags;
+} regex_threads_t;
+
+/*
+ * Add a thread at state st to the list, following empty transitions
+ * in order of priority, and recording the position in the tags
+ * of the thread when passing nfa_tag states.
+ */
+static void regex_groups_add(nfa_t *nfa, regex_threads_t *list, int ntags,
+                             int st, cnum *tags, cnum pos, unsigned visited)
+{
+  nfa_state_t *s;
+
+  if (st == NFA_NONE || nfa->visited[st] == visited)
+    return;
+
+  nfa->visited[st] = visited;
+  s = &nfa->states[st];
+
+  switch (s->kind) {
+  case nfa_empty:
+    regex_groups_add(nfa, list, ntags, s->trans0, tags, pos, visited);
+    regex_groups_add(nfa, list, ntags, s->trans1, tags, pos, visited);
+    break;
+  case nfa_tag:
+    {
+      cnum save = tags[s->set];
+      tags[s->set] = pos;
+      regex_groups_add(nfa, list, ntags, s->trans0, tags, pos, visited);
+      tags[s->set] = save;
+    }
+    break;
+  default:
+    list->state[list->n] = st;
+    memcpy(list->tags + list->n * ntags, tags, ntags * sizeof *tags);
+    list->n++;
+    break;
+  }
+}
+
+val match_regex_groups(val str, val regexes, val pos)
+{
+  val found, groups = gethash_f(regex_groups_cache, regexes, &found);
+  nfa_regex_t *preg;
+  nfa_t *nfa;
+  regex_threads_t list[2], *cur = &list[0], *nxt = &list[1];
+  int ntags, i, matched = 0;
+  cnum *tags, *match;
+  cnum p;
+  val result = nil;
+
+  if (!pos)
+    pos = zero;
+
+  if (!found) {
+    if (c_num(hash_count(regex_groups_cache)) >= REGEX_CACHE_MAX)
+      regex_groups_cache = make_hash(nil, nil, t);
+    groups = regex_groups_compile(regexes);
+    sethash(regex_groups_cache, copy_list(regexes), groups);
+  }
+
+  preg = (nfa_regex_t *) cobj_handle(groups, regex_groups_s);
+  nfa = &preg->nfa;
+  ntags = 2 * preg->nregex;
+
+  for (i = 0; i < 2; i++) {
+    list[i].n = 0;
+    list[i].state = (int *) chk_malloc(nfa->nstates * sizeof *list[i].state);
+    list[i].tags = (cnum *) chk_malloc((nfa->nstates * ntags + 1) *
+                                       sizeof *list[i].tags);
+  }
+
+  tags = (cnum *) chk_malloc((ntags + 1) * sizeof *tags);
+  match = (cnum *) chk_malloc((ntags + 1) * sizeof *match);
+
+  for (i = 0; i < ntags; i++)
+    tags[i] = -1;
+
+  p = c_num(pos);
+  regex_groups_add(nfa, cur, ntags, nfa->start, tags, p, nfa_stamp(nfa));
+
+  for (;;) {
+    regex_threads_t *tmp;
+    wchar_t ch;
+
+    for (i = 0; i < cur->n; i++) {
+      if (cur->state[i] == nfa->accept) {
+        memcpy(match, cur->tags + i * ntags, ntags * sizeof *match);
+        matched = 1;
+        break;
+      }
+    }
+
+    if (cur->n == 0 || !length_str_gt(str, num(p)))
+      break;
+
+    ch = c_chr(chr_str(str, num(p++)));
+    nxt->n = 0;
+
+    {
+      unsigned visited = nfa_stamp(nfa);
+
+      for (i = 0; i < cur->n; i++) {
+        nfa_state_t *s = &nfa->states[cur->state[i]];
+
+        switch (s->kind) {
+        case nfa_wild:
+          break;
+        case nfa_single:
+          if (s->ch == ch)
+            break;
+          continue;
+        case nfa_set:
+          if (char_set_contains(nfa->sets[s->set], ch))
+            break;
+          continue;
+        default:
+          continue;
+        }
+
+        regex_groups_add(nfa, nxt, ntags, s->trans0,
+                         cur->tags + i * ntags, p, visited);
+      }
+    }
+
+    tmp = cur;
+    cur = nxt;
+    nxt = tmp;
+  }
+
+  if (matched) {
+    for (i = ntags - 2; i >= 0; i -= 2)
+      result = cons(cons(num(match[i]), num(match[i + 1])), result);
+  }
+
+  for (i = 0; i < 2; i++) {
+    free(list[i].state);
+    free(list[i].tags);
+  }
+
+  free(tags);
+  free(match);
+  return result;
+}
+
+/*
+ * The reverse of a regex, with an implicit .* in front, for searching
+ * from the end of a string: after the characters from the end down to
+ * some position are fed to it, it accepts if a match of the original
+ * regex starts at that position. Made on first use, and kept.
+ */
+static val regex_reverse(val regex)
+{
+  val any = list(zeroplus_s, wild_s, nao);
+
+  if (consp(regex)) {
+    dv_regex_t *dv = dv_regex(regex);
+
+    if (!dv->reverse) {
+      val term = dv_normalize(list(compound_s, any,
+                                   reg_reverse(second(regex)), nao));
+      dv->reverse = dv_regex_compile(term, nil);
+      mut(third(regex));
+    }
+
+    return dv->reverse;
+  } else {
+    nfa_regex_t *preg = regex_nfa(regex);
+
+    if (!preg->reverse) {
+      preg->reverse = regex_compile_uncached(list(compound_s, any,
+                                                  reg_reverse(preg->source),
+                                                  nao));
+      mut(regex);
+    }
+
+    return preg->reverse;
+  }
+}
+
+#define REGEX_MAX_THREADS 64
+
+typedef struct regex_thread {
+  uint_ptr_t state;
+  cnum start;
+} regex_thread_t;
+
+/*
+ * Unanchored search for the leftmost, longest match in one pass. A
+ * thread is started at each position until a match is found; a thread is
+ * a DFA, bit-parallel or derivative state, with the position at which it
+ * started.
+ * Threads are kept in order of starting position. Of two threads in the
+ * same state, the later one is dropped, since it can match only what the
+ * earlier one matches, only shorter. When a thread accepts, the threads
+ * after it are dropped and no more are started; those before it may still
+ * yield a match which starts further left.
+ *
+ * Returns 1 if a match is found, storing its extent in *pstart and *pend,
+ * or 0 if there is none. Returns -1 if the DFA is full, or there are too
+ * many threads; the caller must then search some other way.
+ */
+static int regex_search_threads(val regex, val haystack, cnum pos,
+                                cnum *pstart, cnum *pend)
+{
+  int is_nfa = !consp(regex);
+  nfa_regex_t *preg = if3(is_nfa, regex_nfa(regex), 0);
+  bp_t *bp = if3(is_nfa, preg->bp, 0);
+  dv_regex_t *dv = if3(is_nfa, 0, dv_regex(regex));
+  val memo = if3(is_nfa, nil, dv->memo);
+  uint_ptr_t start_state = if3(bp, BP_BIT(0),
+                               if3(is_nfa, (uint_ptr_t) preg->dfa->start,
+                                   (uint_ptr_t) dv->start));
+  int lazy = (lazy_stringp(haystack) != nil);
+  val literals = if3(is_nfa, preg->literals, dv->literals);
+  const wchar_t *prefix = if3(literals && !lazy, c_str(car(literals)), 0);
+  regex_thread_t thr[REGEX_MAX_THREADS];
+  regex_text_t txt;
+  int nthr = 0, open = 1;
+  cnum i, best_start = -1, best_end = -1;
+
+  if (!lazy)
+    regex_text_init(&txt, haystack);
+
+  for (i = pos; ; i++) {
+    int j, k, l;
+    wchar_t ch;
+
+    if (nthr == 0 && prefix && prefix[0]) {
+      if ((i = regex_text_find(&txt, i, prefix)) < 0)
+        break;
+    }
+
+    if (open) {
+      for (j = 0; j < nthr; j++)
+        if (thr[j].state == start_state)
+          break;
+
+      if (j == nthr) {
+        if (nthr == REGEX_MAX_THREADS)
+          return -1;
+        thr[nthr].state = start_state;
+        thr[nthr++].start = i;
+      }
+    }
+
+    for (j = 0; j < nthr; j++) {
+      uint_ptr_t st = thr[j].state;
+      if (bp ? (st & bp->last) != 0
+             : is_nfa ? ((dfa_state_t *) st)->accept
+                      : ((val) st)->v.vec[dv_nullable] != nil)
+        break;
+    }
+
+    if (j < nthr) {
+      best_start = thr[j].start;
+      best_end = i;
+      nthr = j + 1;
+      open = 0;
+    }
+
+    if (nthr == 0)
+      break;
+
+    if (lazy ? !length_str_gt(haystack, num(i))
+             : regex_text_ref(&txt, i) == 0)
+      break;
+
+    ch = if3(lazy, c_chr(chr_str(haystack, num(i))),
+             regex_text_ref(&txt, i));
+
+    for (j = k = 0; j < nthr; j++) {
+      uint_ptr_t next;
+
+      if (bp) {
+        next = bp_step(bp, thr[j].state, ch);
+        if (next == 0)
+          continue;
+      } else if (is_nfa) {
+        dfa_state_t *ds = dfa_step(&preg->nfa, preg->dfa,
+                                   (dfa_state_t *) thr[j].state, ch);
+        if (!ds)
+          return -1;
+        if (ds->nstates == 0)
+          continue;
+        next = (uint_ptr_t) ds;
+      } else {
+        val st = dv_step(memo, (val) thr[j].state, ch);
+        if (st->v.vec[dv_term] == t)
+          continue;
+        next = (uint_ptr_t) st;
+      }
+
+      for (l = 0; l < k; l++)
+        if (thr[l].state == next)
+          break;
+
+      if (l == k) {
+        thr[k].state = next;
+        thr[k++].start = thr[j].start;
+      }
+    }
+
+    nthr = k;
+  }
+
+  if (best_start < 0)
+    return 0;
+
+  *pstart = best_start;
+  *pend = best_end;
+  return 1;
+}
 
 val search_regex(val haystack, val needle_regex, val start,
                  val from_end)
@@ -1767,46 +3245,54 @@ val search_regex(val haystack, val needle_regex, val start,
   if (length_str_lt(haystack, start)) {
     return nil;
   } else {
+    val literals = if3(consp(needle_regex), dv_regex(needle_regex)->literals,
+                       regex_nfa(needle_regex)->literals);
+    regex_text_t txt;
+
+    if (from_end || !lazy_stringp(haystack))
+      regex_text_init(&txt, haystack);
+
+    if (literals && !lazy_stringp(haystack) &&
+        (from_end || length_str_gt(cdr(literals), length_str(car(literals)))) &&
+        c_str(cdr(literals))[0] &&
+        regex_text_find(&txt, c_num(start), c_str(cdr(literals))) < 0)
+      return nil;
+
     if (from_end) {
-      cnum i;
       cnum s = c_num(start);
-      const wchar_t *h = c_str(haystack);
-
-      for (i = c_num(length_str(haystack)) - 1; i >= s; i--) {
-        cnum span = regex_run(needle_regex, h + i);
-        if (span >= 0)
-          return cons(num(i), num(span));
-      }
-    } else {
+      cnum i = c_num(length_str(haystack));
       regex_machine_t regm;
-      val i, pos = start, retval;
-      regm_result_t last_res = REGM_INCOMPLETE;
-
-      regex_machine_init(&regm, needle_regex);
 
-again:
-      for (i = pos; length_str_gt(haystack, i); i = plus(i, one)) {
-        last_res = regex_machine_feed(&regm, c_chr(chr_str(haystack, i)));
+      regex_machine_init(&regm, regex_reverse(needle_regex));
 
-        if (last_res == REGM_FAIL) {
-          regex_machine_reset(&regm);
-          pos = plus(pos, one);
-          goto again;
+      while (i-- > s) {
+        if (regex_machine_feed(&regm, regex_text_ref(&txt, i)) == REGM_MATCH) {
+          regex_machine_cleanup(&regm);
+          return cons(num(i), num(regex_run(needle_regex, &txt, i)));
         }
       }
 
-      last_res = regex_machine_feed(&regm, 0);
+      regex_machine_cleanup(&regm);
+    } else {
+      val pos;
+      cnum mstart, mend;
 
-      switch (last_res) {
-      case REGM_INCOMPLETE:
-      case REGM_MATCH:
-        retval = cons(pos, num(regex_machine_match_span(&regm)));
-        regex_machine_cleanup(&regm);
-        return retval;
-      case REGM_FAIL:
-        regex_machine_cleanup(&regm);
+      switch (regex_search_threads(needle_regex, haystack, c_num(start),
+                                   &mstart, &mend))
+      {
+      case 1:
+        return cons(num(mstart), num(mend - mstart));
+      case 0:
         return nil;
       }
+
+      for (pos = start; ; pos = plus(pos, one)) {
+        val end = match_regex(haystack, needle_regex, pos);
+        if (end)
+          return cons(pos, minus(end, pos));
+        if (!length_str_gt(haystack, pos))
+          break;
+      }
     }
 
     return nil;
@@ -1823,10 +3309,23 @@ val match_regex(val str, val reg, val pos)
 
   regex_machine_init(&regm, reg);
 
-  for (i = pos; length_str_gt(str, i); i = plus(i, one)) {
-    last_res = regex_machine_feed(&regm, c_chr(chr_str(str, i)));
-    if (last_res == REGM_FAIL)
-      break;
+  if (!lazy_stringp(str)) {
+    regex_text_t txt;
+    cnum j, len = c_num(length_str(str));
+
+    regex_text_init(&txt, str);
+
+    for (j = c_num(pos); j < len; j++) {
+      last_res = regex_machine_feed(&regm, regex_text_ref(&txt, j));
+      if (last_res == REGM_FAIL)
+        break;
+    }
+  } else {
+    for (i = pos; length_str_gt(str, i); i = plus(i, one)) {
+      last_res = regex_machine_feed(&regm, c_chr(chr_str(str, i)));
+      if (last_res == REGM_FAIL)
+        break;
+    }
   }
 
   last_res = regex_machine_feed(&regm, 0);
@@ -1889,4 +3388,13 @@ void regex_init(void)
   cword_char_k = intern(lit("cword-char"), keyword_package);
 
   init_special_char_sets();
+
+  regex_set_s = intern(lit("regex-set"), system_package);
+  regex_groups_s = intern(lit("regex-groups"), system_package);
+  dv_regex_s = intern(lit("dv-regex"), system_package);
+
+  prot1(&regex_cache);
+  prot1(&regex_groups_cache);
+  regex_groups_cache = make_hash(nil, nil, t);
+  regex_cache = make_hash(nil, nil, t);
 }
@@ -28,9 +28,13 @@ extern val space_k, digit_k, word_char_k;
 extern val cspace_k, cdigit_k, cword_char_k;
 
 val regex_compile(val regex_sexp);
+val regex_cache_stats(void);
 val regexp(val);
 val search_regex(val haystack, val needle_regex, val start_num, val from_end);
 val match_regex(val str, val regex, val pos);
+val match_regex_groups(val str, val regexes, val pos);
 val regsub(val regex, val repl, val str);
+val regex_set_compile(val regexes);
+val regex_set_match(val set, val str, val pos);
 
 void regex_init(void);
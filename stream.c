@@ -173,18 +173,26 @@ static val stdio_flush(val stream)
   return t;
 }
 
-static wchar_t *snarf_line(struct stdio_handle *h)
+/*
+ * Lines are decoded into a scratch buffer which is kept
+ * from call to call; the line is then copied to a payload
+ * of the exact size. If a long line grew the buffer past
+ * max_size, it is cut back to min_size, so that one huge
+ * line does not tie up memory for the rest of the run.
+ */
+static val snarf_line(struct stdio_handle *h)
 {
-  const size_t min_size = 512;
-  size_t size = 0;
+  static wchar_t *buf;
+  static size_t size;
+  const size_t min_size = 512, max_size = 8192;
   size_t fill = 0;
-  wchar_t *buf = 0;
+  val line;
 
   for (;;) {
     wint_t ch = utf8_decode(&h->ud, stdio_get_char_callback, (mem_t *) h->f);
 
-    if (ch == WEOF && buf == 0)
-      break;
+    if (ch == WEOF && fill == 0)
+      return 0;
 
     if (fill >= size) {
       size_t newsize = size ? size * 2 : min_size;
@@ -199,10 +207,14 @@ static wchar_t *snarf_line(struct stdio_handle *h)
     buf[fill++] = ch;
   }
 
-  if (buf)
-    buf = (wchar_t *) chk_realloc((mem_t *) buf, fill * sizeof *buf);
+  line = string_compact(buf, fill - 1);
+
+  if (size > max_size) {
+    buf = (wchar_t *) chk_realloc((mem_t *) buf, min_size * sizeof *buf);
+    size = min_size;
+  }
 
-  return buf;
+  return line;
 }
 
 static val stdio_get_line(val stream)
@@ -211,10 +223,10 @@ static val stdio_get_line(val stream)
     return stdio_maybe_read_error(stream);
   } else {
     struct stdio_handle *h = (struct stdio_handle *) stream->co.handle;
-    wchar_t *line = snarf_line(h);
+    val line = snarf_line(h);
     if (!line)
       return stdio_maybe_read_error(stream);
-    return string_own(line);
+    return line;
   }
 }
 
@@ -111,6 +111,27 @@ static void help(void)
 "--version              Display program version\n"
 "--lisp-bindings        Synonym for -l\n"
 "--debugger             Synonym for -d\n"
+"--gc-live-percent num  Size the heap so that live objects occupy about\n"
+"                       num percent of it. The default is 50.\n"
+"--gc-min-free num      Keep at least num objects free after a full\n"
+"                       garbage collection.\n"
+"--gc-min-heaps num     Never shrink the heap below num heaps.\n"
+"--gc-clear-stack num   Clear num bytes of dead stack after leaving a\n"
+"                       deep recursion, once per garbage collection.\n"
+"--gc-minor-min-free num\n"
+"                       Add a heap if a minor collection frees fewer\n"
+"                       than num objects (generational GC only).\n"
+"--gc-nursery-size num  Do a minor collection after every num object\n"
+"                       allocations (generational GC only).\n"
+"--gc-full-interval num Do a full collection every num collections\n"
+"                       (generational GC only).\n"
+"--gc-threads num       Use num threads for marking in garbage collection.\n"
+"                       The TXR_GC_THREADS environment variable may be\n"
+"                       used instead.\n"
+"--gc-stats             Print garbage collection statistics to standard\n"
+"                       error on exit.\n"
+"--intern-strings       Variables bound to equal text from the data share\n"
+"                       one string object.\n"
 "\n"
 "Options that take no argument can be combined. The -q and -v options\n"
 "are mutually exclusive; the right-most one dominates.\n"
@@ -125,6 +146,11 @@ static void hint(void)
          prog_string, nao);
 }
 
+static void gc_stats_at_exit(void)
+{
+  gc_stats_print(std_error);
+}
+
 static val remove_hash_bang_line(val spec)
 {
   if (!consp(spec))
@@ -178,6 +204,26 @@ int txr_main(int argc, char **argv)
 
   yyin_stream = std_input;
 
+#if HAVE_PTHREADS
+  {
+    char *gc_threads = getenv("TXR_GC_THREADS");
+
+    if (gc_threads && *gc_threads) {
+      char *errp;
+      long optval = strtol(gc_threads, &errp, 10);
+
+      if (*errp != 0 || optval < 1) {
+        format(std_error, lit("~a: TXR_GC_THREADS needs a positive "
+                              "numeric value, not ~a\n"),
+               prog_string, string_utf8(gc_threads), nao);
+        return EXIT_FAILURE;
+      }
+
+      opt_gc_threads = optval;
+    }
+  }
+#endif
+
   if (argc <= 1) {
     hint();
     return EXIT_FAILURE;
@@ -284,10 +330,80 @@ int txr_main(int argc, char **argv)
       continue;
     }
 
+    if (!strcmp(*argv, "--gc-threads")) {
+#if HAVE_PTHREADS
+      long optval;
+      char *errp;
+
+      if (argc == 1) {
+        format(std_error, lit("~a: option ~a needs argument\n"),
+               prog_string, string_utf8(*argv), nao);
+        return EXIT_FAILURE;
+      }
+
+      argv++, argc--;
+
+      optval = strtol(*argv, &errp, 10);
+      if (*errp != 0 || optval < 1) {
+        format(std_error, lit("~a: option --gc-threads needs a positive "
+                              "numeric argument, not ~a\n"),
+               prog_string, string_utf8(*argv), nao);
+        return EXIT_FAILURE;
+      }
+
+      opt_gc_threads = optval;
+      argv++, argc--;
+      continue;
+#else
+      format(std_error,
+             lit("~a: option ~a requires thread support compiled in\n"),
+             prog_string, string_utf8(*argv), nao);
+      return EXIT_FAILURE;
+#endif
+    }
+
+    if (!strncmp(*argv, "--gc-", 5)) {
+      struct gc_param *p;
+
+      for (p = gc_params; p->name != 0; p++)
+        if (!strcmp(*argv + 5, p->name))
+          break;
+
+      if (p->name != 0) {
+        long optval;
+        char *errp;
+
+        if (argc == 1) {
+          format(std_error, lit("~a: option ~a needs argument\n"),
+                 prog_string, string_utf8(*argv), nao);
+          return EXIT_FAILURE;
+        }
+
+        argv++, argc--;
+
+        optval = strtol(*argv, &errp, 10);
+        if (*errp != 0 || optval < p->min || optval > p->max) {
+          format(std_error, lit("~a: option --gc-~a needs a number "
+                                "from ~a to ~a, not ~a\n"),
+                 prog_string, string_utf8(p->name), num(p->min),
+                 num(p->max), string_utf8(*argv), nao);
+          return EXIT_FAILURE;
+        }
+
+        *p->var = optval;
+        argv++, argc--;
+        continue;
+      }
+    }
+
     if (!strcmp(*argv, "--gc-debug")) {
       opt_gc_debug = 1;
       argv++, argc--;
       continue;
+    } else if (!strcmp(*argv, "--gc-stats")) {
+      atexit(gc_stats_at_exit);
+      argv++, argc--;
+      continue;
     } else if (!strcmp(*argv, "--vg-debug")) {
 #ifdef HAVE_VALGRIND
       opt_vg_debug = 1;
@@ -303,6 +419,10 @@ int txr_main(int argc, char **argv)
       opt_derivative_regex = 1;
       argv++, argc--;
       continue;
+    } else if (!strcmp(*argv, "--intern-strings")) {
+      opt_intern_strings = 1;
+      argv++, argc--;
+      continue;
     } else if (!strcmp(*argv, "--lisp-bindings")) {
       opt_lisp_bindings = 1;
       argv++, argc--;
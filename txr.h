@@ -28,11 +28,15 @@ extern int opt_loglevel;
 extern int opt_nobindings;
 extern int opt_lisp_bindings;
 extern int opt_arraydims;
+extern int opt_intern_strings;
 extern int opt_gc_debug;
 #ifdef HAVE_VALGRIND
 extern int opt_vg_debug;
 #endif
 extern int opt_derivative_regex;
+#if HAVE_PTHREADS
+extern int opt_gc_threads;
+#endif
 extern const wchli_t *version;
 extern const wchar_t *progname;
 extern val self_path;
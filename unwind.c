@@ -66,6 +66,7 @@ static void uw_unwind_to_exit_point(void)
       uw_stack->ca.sym = nil;
       uw_stack->ca.exception = nil;
       uw_stack->ca.cont = uw_exit_point;
+      gc_frame_unwind((mem_t *) uw_stack);
       /* 1 means unwind only. */
       longjmp(uw_stack->ca.jb, 1);
       abort();
@@ -83,6 +84,8 @@ static void uw_unwind_to_exit_point(void)
 
   uw_exit_point = 0;
 
+  gc_frame_unwind((mem_t *) uw_stack);
+
   switch (uw_stack->uw.type) {
   case UW_BLOCK:
     longjmp(uw_stack->bl.jb, 1);
@@ -0,0 +1,4801 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 27 "parser.y"
+
+
+#include <stdio.h>
+#include <assert.h>
+#include <limits.h>
+#include <dirent.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include <wchar.h>
+#include "config.h"
+#include "lib.h"
+#include "unwind.h"
+#include "regex.h"
+#include "utf8.h"
+#include "match.h"
+#include "hash.h"
+#include "eval.h"
+#include "parser.h"
+
+int yylex(void);
+void yyerror(const char *);
+
+static val repeat_rep_helper(val sym, val args, val main, val parts);
+static val o_elems_transform(val output_form);
+static val define_transform(val define_form);
+static val lit_char_helper(val litchars);
+static val optimize_text(val text_form);
+static val unquotes_occur(val quoted_form);
+static val choose_quote(val quoted_form);
+static wchar_t char_from_name(wchar_t *name);
+
+static val parsed_spec;
+
+
+#line 106 "y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SPACE = 258,                   /* SPACE  */
+    TEXT = 259,                    /* TEXT  */
+    IDENT = 260,                   /* IDENT  */
+    KEYWORD = 261,                 /* KEYWORD  */
+    METAVAR = 262,                 /* METAVAR  */
+    ALL = 263,                     /* ALL  */
+    SOME = 264,                    /* SOME  */
+    NONE = 265,                    /* NONE  */
+    MAYBE = 266,                   /* MAYBE  */
+    CASES = 267,                   /* CASES  */
+    BLOCK = 268,                   /* BLOCK  */
+    CHOOSE = 269,                  /* CHOOSE  */
+    GATHER = 270,                  /* GATHER  */
+    AND = 271,                     /* AND  */
+    OR = 272,                      /* OR  */
+    END = 273,                     /* END  */
+    COLLECT = 274,                 /* COLLECT  */
+    UNTIL = 275,                   /* UNTIL  */
+    COLL = 276,                    /* COLL  */
+    OUTPUT = 277,                  /* OUTPUT  */
+    REPEAT = 278,                  /* REPEAT  */
+    REP = 279,                     /* REP  */
+    SINGLE = 280,                  /* SINGLE  */
+    FIRST = 281,                   /* FIRST  */
+    LAST = 282,                    /* LAST  */
+    EMPTY = 283,                   /* EMPTY  */
+    MOD = 284,                     /* MOD  */
+    MODLAST = 285,                 /* MODLAST  */
+    DEFINE = 286,                  /* DEFINE  */
+    TRY = 287,                     /* TRY  */
+    CATCH = 288,                   /* CATCH  */
+    FINALLY = 289,                 /* FINALLY  */
+    ERRTOK = 290,                  /* ERRTOK  */
+    HASH_BACKSLASH = 291,          /* HASH_BACKSLASH  */
+    HASH_SLASH = 292,              /* HASH_SLASH  */
+    DOTDOT = 293,                  /* DOTDOT  */
+    HASH_H = 294,                  /* HASH_H  */
+    NUMBER = 295,                  /* NUMBER  */
+    METANUM = 296,                 /* METANUM  */
+    REGCHAR = 297,                 /* REGCHAR  */
+    REGTOKEN = 298,                /* REGTOKEN  */
+    LITCHAR = 299,                 /* LITCHAR  */
+    METAPAR = 300,                 /* METAPAR  */
+    METABKT = 301,                 /* METABKT  */
+    SPLICE = 302,                  /* SPLICE  */
+    LOW = 303                      /* LOW  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define SPACE 258
+#define TEXT 259
+#define IDENT 260
+#define KEYWORD 261
+#define METAVAR 262
+#define ALL 263
+#define SOME 264
+#define NONE 265
+#define MAYBE 266
+#define CASES 267
+#define BLOCK 268
+#define CHOOSE 269
+#define GATHER 270
+#define AND 271
+#define OR 272
+#define END 273
+#define COLLECT 274
+#define UNTIL 275
+#define COLL 276
+#define OUTPUT 277
+#define REPEAT 278
+#define REP 279
+#define SINGLE 280
+#define FIRST 281
+#define LAST 282
+#define EMPTY 283
+#define MOD 284
+#define MODLAST 285
+#define DEFINE 286
+#define TRY 287
+#define CATCH 288
+#define FINALLY 289
+#define ERRTOK 290
+#define HASH_BACKSLASH 291
+#define HASH_SLASH 292
+#define DOTDOT 293
+#define HASH_H 294
+#define NUMBER 295
+#define METANUM 296
+#define REGCHAR 297
+#define REGTOKEN 298
+#define LITCHAR 299
+#define METAPAR 300
+#define METABKT 301
+#define SPLICE 302
+#define LOW 303
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 62 "parser.y"
+
+  wchar_t *lexeme;
+  union obj *val;
+  wchar_t chr;
+  cnum lineno;
+
+#line 262 "y.tab.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_TEXT = 4,                       /* TEXT  */
+  YYSYMBOL_IDENT = 5,                      /* IDENT  */
+  YYSYMBOL_KEYWORD = 6,                    /* KEYWORD  */
+  YYSYMBOL_METAVAR = 7,                    /* METAVAR  */
+  YYSYMBOL_ALL = 8,                        /* ALL  */
+  YYSYMBOL_SOME = 9,                       /* SOME  */
+  YYSYMBOL_NONE = 10,                      /* NONE  */
+  YYSYMBOL_MAYBE = 11,                     /* MAYBE  */
+  YYSYMBOL_CASES = 12,                     /* CASES  */
+  YYSYMBOL_BLOCK = 13,                     /* BLOCK  */
+  YYSYMBOL_CHOOSE = 14,                    /* CHOOSE  */
+  YYSYMBOL_GATHER = 15,                    /* GATHER  */
+  YYSYMBOL_AND = 16,                       /* AND  */
+  YYSYMBOL_OR = 17,                        /* OR  */
+  YYSYMBOL_END = 18,                       /* END  */
+  YYSYMBOL_COLLECT = 19,                   /* COLLECT  */
+  YYSYMBOL_UNTIL = 20,                     /* UNTIL  */
+  YYSYMBOL_COLL = 21,                      /* COLL  */
+  YYSYMBOL_OUTPUT = 22,                    /* OUTPUT  */
+  YYSYMBOL_REPEAT = 23,                    /* REPEAT  */
+  YYSYMBOL_REP = 24,                       /* REP  */
+  YYSYMBOL_SINGLE = 25,                    /* SINGLE  */
+  YYSYMBOL_FIRST = 26,                     /* FIRST  */
+  YYSYMBOL_LAST = 27,                      /* LAST  */
+  YYSYMBOL_EMPTY = 28,                     /* EMPTY  */
+  YYSYMBOL_MOD = 29,                       /* MOD  */
+  YYSYMBOL_MODLAST = 30,                   /* MODLAST  */
+  YYSYMBOL_DEFINE = 31,                    /* DEFINE  */
+  YYSYMBOL_TRY = 32,                       /* TRY  */
+  YYSYMBOL_CATCH = 33,                     /* CATCH  */
+  YYSYMBOL_FINALLY = 34,                   /* FINALLY  */
+  YYSYMBOL_ERRTOK = 35,                    /* ERRTOK  */
+  YYSYMBOL_HASH_BACKSLASH = 36,            /* HASH_BACKSLASH  */
+  YYSYMBOL_HASH_SLASH = 37,                /* HASH_SLASH  */
+  YYSYMBOL_DOTDOT = 38,                    /* DOTDOT  */
+  YYSYMBOL_HASH_H = 39,                    /* HASH_H  */
+  YYSYMBOL_NUMBER = 40,                    /* NUMBER  */
+  YYSYMBOL_METANUM = 41,                   /* METANUM  */
+  YYSYMBOL_REGCHAR = 42,                   /* REGCHAR  */
+  YYSYMBOL_REGTOKEN = 43,                  /* REGTOKEN  */
+  YYSYMBOL_LITCHAR = 44,                   /* LITCHAR  */
+  YYSYMBOL_METAPAR = 45,                   /* METAPAR  */
+  YYSYMBOL_METABKT = 46,                   /* METABKT  */
+  YYSYMBOL_SPLICE = 47,                    /* SPLICE  */
+  YYSYMBOL_48_ = 48,                       /* '('  */
+  YYSYMBOL_49_ = 49,                       /* '['  */
+  YYSYMBOL_LOW = 50,                       /* LOW  */
+  YYSYMBOL_51_ = 51,                       /* '{'  */
+  YYSYMBOL_52_ = 52,                       /* '}'  */
+  YYSYMBOL_53_ = 53,                       /* ']'  */
+  YYSYMBOL_54_ = 54,                       /* ')'  */
+  YYSYMBOL_55_ = 55,                       /* '-'  */
+  YYSYMBOL_56_ = 56,                       /* ','  */
+  YYSYMBOL_57_ = 57,                       /* '\''  */
+  YYSYMBOL_58_ = 58,                       /* '|'  */
+  YYSYMBOL_59_ = 59,                       /* '/'  */
+  YYSYMBOL_60_ = 60,                       /* '&'  */
+  YYSYMBOL_61_ = 61,                       /* '~'  */
+  YYSYMBOL_62_ = 62,                       /* '*'  */
+  YYSYMBOL_63_ = 63,                       /* '?'  */
+  YYSYMBOL_64_ = 64,                       /* '+'  */
+  YYSYMBOL_65_ = 65,                       /* '%'  */
+  YYSYMBOL_66_ = 66,                       /* '.'  */
+  YYSYMBOL_67_n_ = 67,                     /* '\n'  */
+  YYSYMBOL_68_ = 68,                       /* '#'  */
+  YYSYMBOL_69_ = 69,                       /* '"'  */
+  YYSYMBOL_70_ = 70,                       /* '`'  */
+  YYSYMBOL_YYACCEPT = 71,                  /* $accept  */
+  YYSYMBOL_spec = 72,                      /* spec  */
+  YYSYMBOL_clauses = 73,                   /* clauses  */
+  YYSYMBOL_clauses_opt = 74,               /* clauses_opt  */
+  YYSYMBOL_clause = 75,                    /* clause  */
+  YYSYMBOL_all_clause = 76,                /* all_clause  */
+  YYSYMBOL_some_clause = 77,               /* some_clause  */
+  YYSYMBOL_none_clause = 78,               /* none_clause  */
+  YYSYMBOL_maybe_clause = 79,              /* maybe_clause  */
+  YYSYMBOL_cases_clause = 80,              /* cases_clause  */
+  YYSYMBOL_block_clause = 81,              /* block_clause  */
+  YYSYMBOL_choose_clause = 82,             /* choose_clause  */
+  YYSYMBOL_gather_clause = 83,             /* gather_clause  */
+  YYSYMBOL_gather_parts = 84,              /* gather_parts  */
+  YYSYMBOL_additional_gather_parts = 85,   /* additional_gather_parts  */
+  YYSYMBOL_collect_clause = 86,            /* collect_clause  */
+  YYSYMBOL_until_last = 87,                /* until_last  */
+  YYSYMBOL_clause_parts = 88,              /* clause_parts  */
+  YYSYMBOL_additional_parts = 89,          /* additional_parts  */
+  YYSYMBOL_line = 90,                      /* line  */
+  YYSYMBOL_elems_opt = 91,                 /* elems_opt  */
+  YYSYMBOL_elems = 92,                     /* elems  */
+  YYSYMBOL_text = 93,                      /* text  */
+  YYSYMBOL_texts = 94,                     /* texts  */
+  YYSYMBOL_elem = 95,                      /* elem  */
+  YYSYMBOL_clause_parts_h = 96,            /* clause_parts_h  */
+  YYSYMBOL_additional_parts_h = 97,        /* additional_parts_h  */
+  YYSYMBOL_define_clause = 98,             /* define_clause  */
+  YYSYMBOL_try_clause = 99,                /* try_clause  */
+  YYSYMBOL_catch_clauses_opt = 100,        /* catch_clauses_opt  */
+  YYSYMBOL_output_clause = 101,            /* output_clause  */
+  YYSYMBOL_out_clauses = 102,              /* out_clauses  */
+  YYSYMBOL_out_clause = 103,               /* out_clause  */
+  YYSYMBOL_repeat_clause = 104,            /* repeat_clause  */
+  YYSYMBOL_repeat_parts_opt = 105,         /* repeat_parts_opt  */
+  YYSYMBOL_out_clauses_opt = 106,          /* out_clauses_opt  */
+  YYSYMBOL_o_line = 107,                   /* o_line  */
+  YYSYMBOL_o_elems_opt = 108,              /* o_elems_opt  */
+  YYSYMBOL_o_elems = 109,                  /* o_elems  */
+  YYSYMBOL_o_elem = 110,                   /* o_elem  */
+  YYSYMBOL_rep_elem = 111,                 /* rep_elem  */
+  YYSYMBOL_rep_parts_opt = 112,            /* rep_parts_opt  */
+  YYSYMBOL_var = 113,                      /* var  */
+  YYSYMBOL_var_op = 114,                   /* var_op  */
+  YYSYMBOL_modifiers = 115,                /* modifiers  */
+  YYSYMBOL_o_var = 116,                    /* o_var  */
+  YYSYMBOL_vector = 117,                   /* vector  */
+  YYSYMBOL_hash = 118,                     /* hash  */
+  YYSYMBOL_list = 119,                     /* list  */
+  YYSYMBOL_meta_expr = 120,                /* meta_expr  */
+  YYSYMBOL_exprs = 121,                    /* exprs  */
+  YYSYMBOL_exprs_opt = 122,                /* exprs_opt  */
+  YYSYMBOL_expr = 123,                     /* expr  */
+  YYSYMBOL_regex = 124,                    /* regex  */
+  YYSYMBOL_lisp_regex = 125,               /* lisp_regex  */
+  YYSYMBOL_regexpr = 126,                  /* regexpr  */
+  YYSYMBOL_regbranch = 127,                /* regbranch  */
+  YYSYMBOL_regterm = 128,                  /* regterm  */
+  YYSYMBOL_regclass = 129,                 /* regclass  */
+  YYSYMBOL_regclassterm = 130,             /* regclassterm  */
+  YYSYMBOL_regrange = 131,                 /* regrange  */
+  YYSYMBOL_regchar = 132,                  /* regchar  */
+  YYSYMBOL_regtoken = 133,                 /* regtoken  */
+  YYSYMBOL_newl = 134,                     /* newl  */
+  YYSYMBOL_strlit = 135,                   /* strlit  */
+  YYSYMBOL_chrlit = 136,                   /* chrlit  */
+  YYSYMBOL_quasilit = 137,                 /* quasilit  */
+  YYSYMBOL_quasi_items = 138,              /* quasi_items  */
+  YYSYMBOL_quasi_item = 139,               /* quasi_item  */
+  YYSYMBOL_litchars = 140                  /* litchars  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  144
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   3619
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  71
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  70
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  285
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  522
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   303
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      67,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    69,    68,     2,    65,    60,    57,
+      48,    54,    62,    64,    56,    55,    66,    59,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    63,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    49,     2,    53,     2,     2,    70,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    51,    58,    52,    61,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    50
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   113,   113,   114,   115,   123,   124,   127,   128,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   143,
+     144,   145,   146,   150,   152,   155,   160,   163,   168,   173,
+     175,   178,   182,   184,   187,   191,   193,   196,   200,   210,
+     216,   219,   223,   228,   236,   246,   250,   255,   258,   259,
+     260,   263,   268,   275,   286,   287,   290,   293,   294,   295,
+     298,   301,   302,   305,   307,   309,   314,   315,   323,   328,
+     329,   332,   334,   335,   339,   341,   346,   348,   349,   350,
+     352,   353,   354,   355,   356,   357,   358,   359,   362,   363,
+     367,   370,   371,   372,   375,   379,   383,   385,   387,   392,
+     400,   407,   413,   418,   423,   428,   429,   433,   437,   444,
+     448,   450,   453,   458,   463,   465,   468,   471,   474,   479,
+     480,   483,   484,   485,   487,   489,   491,   493,   495,   497,
+     499,   502,   504,   508,   514,   519,   523,   527,   531,   535,
+     541,   547,   551,   552,   554,   557,   559,   562,   563,   566,
+     568,   570,   571,   572,   575,   581,   585,   588,   591,   594,
+     597,   602,   607,   614,   616,   618,   620,   622,   624,   627,
+     629,   631,   633,   635,   638,   642,   644,   648,   651,   652,
+     655,   658,   660,   662,   664,   666,   670,   677,   686,   687,
+     688,   689,   690,   694,   696,   700,   702,   706,   707,   711,
+     712,   715,   718,   719,   720,   723,   724,   727,   729,   732,
+     735,   737,   738,   739,   740,   741,   742,   745,   746,   747,
+     748,   751,   753,   758,   761,   766,   769,   770,   771,   772,
+     775,   776,   777,   780,   781,   782,   783,   784,   791,   792,
+     795,   796,   797,   798,   799,   800,   801,   806,   807,   810,
+     811,   812,   815,   817,   818,   819,   820,   821,   822,   823,
+     824,   825,   826,   827,   828,   831,   845,   846,   850,   851,
+     853,   857,   868,   870,   875,   876,   878,   882,   883,   886,
+     887,   888,   889,   891,   894,   895
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "TEXT",
+  "IDENT", "KEYWORD", "METAVAR", "ALL", "SOME", "NONE", "MAYBE", "CASES",
+  "BLOCK", "CHOOSE", "GATHER", "AND", "OR", "END", "COLLECT", "UNTIL",
+  "COLL", "OUTPUT", "REPEAT", "REP", "SINGLE", "FIRST", "LAST", "EMPTY",
+  "MOD", "MODLAST", "DEFINE", "TRY", "CATCH", "FINALLY", "ERRTOK",
+  "HASH_BACKSLASH", "HASH_SLASH", "DOTDOT", "HASH_H", "NUMBER", "METANUM",
+  "REGCHAR", "REGTOKEN", "LITCHAR", "METAPAR", "METABKT", "SPLICE", "'('",
+  "'['", "LOW", "'{'", "'}'", "']'", "')'", "'-'", "','", "'\\''", "'|'",
+  "'/'", "'&'", "'~'", "'*'", "'?'", "'+'", "'%'", "'.'", "'\\n'", "'#'",
+  "'\"'", "'`'", "$accept", "spec", "clauses", "clauses_opt", "clause",
+  "all_clause", "some_clause", "none_clause", "maybe_clause",
+  "cases_clause", "block_clause", "choose_clause", "gather_clause",
+  "gather_parts", "additional_gather_parts", "collect_clause",
+  "until_last", "clause_parts", "additional_parts", "line", "elems_opt",
+  "elems", "text", "texts", "elem", "clause_parts_h", "additional_parts_h",
+  "define_clause", "try_clause", "catch_clauses_opt", "output_clause",
+  "out_clauses", "out_clause", "repeat_clause", "repeat_parts_opt",
+  "out_clauses_opt", "o_line", "o_elems_opt", "o_elems", "o_elem",
+  "rep_elem", "rep_parts_opt", "var", "var_op", "modifiers", "o_var",
+  "vector", "hash", "list", "meta_expr", "exprs", "exprs_opt", "expr",
+  "regex", "lisp_regex", "regexpr", "regbranch", "regterm", "regclass",
+  "regclassterm", "regrange", "regchar", "regtoken", "newl", "strlit",
+  "chrlit", "quasilit", "quasi_items", "quasi_item", "litchars", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-424)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-230)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    1214,   -34,  -424,  -424,  2174,  2294,  3014,  2354,  2414,  2474,
+    3014,  3014,  3014,  3014,   904,   930,   850,   984,  1010,    44,
+    3014,  1064,  1090,    71,  3014,  3014,   211,  -424,    63,  -424,
+    3082,  -424,  -424,  -424,  -424,  -424,  -424,  -424,  -424,  -424,
+    -424,    14,  -424,    50,  -424,  2805,  -424,  -424,  -424,  -424,
+    -424,  -424,    57,  -424,  -424,  -424,  -424,  3233,  3014,  3293,
+    3353,  3413,  3014,  3014,  -424,    31,  -424,  -424,   172,  -424,
+    1394,  -424,  -424,  -424,    59,  2331,   112,  -424,  -424,  1143,
+    2903,   112,    58,   695,  -424,  -424,  -424,  -424,  -424,    52,
+    2866,  -424,  -424,  -424,  -424,  -424,  -424,  1454,  -424,  -424,
+    1514,  -424,  -424,  1574,    66,    67,    77,    79,  -424,    93,
+    -424,  2272,    97,   108,   103,  -424,   117,  -424,    44,   123,
+    2054,    87,  -424,  -424,   125,  -424,  -424,   127,   432,    87,
+      87,  -424,  -424,  -424,  2394,  2154,  -424,  -424,   873,  -424,
+     180,  -424,  2508,  -424,  -424,  -424,  -424,  -424,  -424,  -424,
+    3557,   107,   137,   138,   141,  -424,  2805,  2805,  -424,  -424,
+    -424,    44,   226,  -424,  -424,  -424,  -424,  -424,   191,  -424,
+    -424,  -424,   148,  -424,   131,  -424,  -424,   160,  -424,   149,
+    -424,  -424,   818,  -424,  3014,  -424,  -424,  -424,   150,  1120,
+    -424,  2534,  3014,  3014,  -424,  -424,    44,  -424,  -424,    44,
+    -424,  -424,    44,  -424,    44,  2594,    44,    44,  2805,  -424,
+    -424,   156,   758,  -424,  -424,  -424,  2234,  2272,    44,  -424,
+     758,  1634,  2834,  -424,    49,  -424,  -424,  -424,  3557,   173,
+    -424,  -424,  -424,   159,  -424,  -424,  -424,  -424,  -424,  -424,
+    -424,  -424,  -424,  -424,  -424,  -424,  -424,  -424,   174,  2448,
+    -424,   192,  -424,  -424,   873,  -424,   873,   873,  -424,  -424,
+    -424,   873,  -424,  -424,    26,  3473,  3533,  2805,   172,   172,
+    -424,    44,    44,    44,  -424,  -424,  -424,  -424,  -424,  -424,
+    -424,  -424,  2940,  -424,  -424,  -424,  -424,  1694,    87,    87,
+    -424,  -424,  -424,  1754,  -424,  -424,  1814,  1874,  2114,    99,
+    2654,  -424,  -424,    44,  3014,    44,    44,    44,  3014,    44,
+    1010,  -424,  -424,  -424,  -424,  -424,  -424,  -424,  -424,  -424,
+    -424,   210,  3142,  -424,  -424,   179,  -424,   185,  2714,  3142,
+     315,  -424,  -424,   237,   238,  1934,  -424,  2977,    44,   239,
+    -424,  3557,  -424,  -424,  -424,  2568,   198,  -424,  -424,  -424,
+     213,  3557,   215,  -424,  -424,  3173,  3173,  -424,   216,  -424,
+      44,  -424,  -424,   245,  -424,    44,  -424,  -424,    44,    74,
+     116,  -424,   176,  -424,  -424,  -424,  2805,  -424,   255,   220,
+     221,  -424,   224,    44,  -424,  -424,  2774,  -424,   261,  -424,
+     386,   758,   758,   758,   758,  3014,  3014,   269,    44,  -424,
+    -424,   270,    44,   235,  1994,    44,  -424,  -424,  -424,  -424,
+    -424,   226,   226,   758,  -424,    44,  -424,  -424,    44,    44,
+    -424,    44,    44,    44,    44,   272,    44,    44,    44,    44,
+    -424,  -424,   277,    44,    44,    44,    44,    44,  3014,  3014,
+     278,   315,   315,   315,   315,   243,   246,  -424,  -424,    44,
+    1274,    44,  -424,  -424,  -424,  -424,  -424,  -424,  -424,  3173,
+    3173,  -424,  3173,  -424,  3173,  -424,  -424,    44,  -424,  3142,
+    3142,  3142,  3142,   247,   253,    44,  -424,  -424,  -424,  -424,
+     758,   758,  -424,  -424,    60,  1334,    74,   226,   281,   290,
+    -424,   386,   386,   386,   386,    44,    44,  -424,   315,   315,
+    -424,  -424,    60,  -424,  -424,    44,    44,  -424,  -424,  -424,
+    -424,  3142,  3142,  -424,  -424,  -424,  -424,  -424,   386,   386,
+    -424,  -424
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,    67,    66,     0,     0,   206,     0,     0,     0,
+     206,   206,   206,   206,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   177,     0,     2,
+       5,     9,    10,    11,    12,    13,    14,    15,    17,    16,
+      21,     0,    61,    69,    71,    63,    18,    19,    20,    22,
+      65,    72,     0,    73,    68,     4,   175,     0,   206,     0,
+       0,     0,   206,     0,   164,     0,    78,   266,     0,    77,
+       0,   207,   208,   209,     0,     0,     0,   211,   210,     0,
+       0,     0,     0,     0,   213,   214,   212,   215,   205,     0,
+     202,   216,   218,   217,   219,    82,    81,     0,    84,    83,
+       0,    86,    85,     0,     0,     0,     0,     0,    76,     0,
+     114,     0,     0,     0,     0,   155,     0,    96,     0,     0,
+       0,   194,   195,   189,     0,   196,   191,     0,     0,   192,
+     193,   222,   243,   265,     0,     0,   241,   242,   229,   240,
+       0,   225,   230,   244,     1,     6,    60,    70,    64,   176,
+     169,     0,     0,     0,     0,   267,     0,     0,    91,    90,
+      24,     0,     0,    23,   273,   271,   272,   224,     0,   187,
+     201,   199,     0,   200,     0,   186,   270,   284,   268,     0,
+     276,   280,     0,   282,     0,   274,   281,   283,     0,   277,
+     279,     0,     0,     0,   203,    30,     0,    29,    33,     0,
+      32,    36,     0,    35,     0,     0,     0,     0,     0,   150,
+     149,     0,   147,   153,   151,   152,     0,     0,     0,   134,
+     146,     0,     0,   100,     0,   188,   190,   178,   165,     0,
+     180,   179,   246,     0,   239,   264,   257,   238,   258,   259,
+     263,   261,   260,   255,   253,   256,   262,   254,     0,   247,
+     249,   250,   251,   228,   229,   221,   229,   229,   233,   235,
+     234,   229,   231,   170,     0,     0,     0,     0,     0,     0,
+      25,     0,     0,     0,    56,   223,   197,   198,   285,   269,
+     185,   182,   206,   275,   278,    80,    79,     0,   220,   204,
+      31,    34,    37,     0,    88,    87,     0,     0,     0,     0,
+       0,   148,   116,     0,   206,     0,     0,     0,   206,     0,
+       0,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,     0,   119,   121,   122,     0,   145,     0,     0,   143,
+     162,    98,     7,     0,     0,     0,   101,     0,     0,     0,
+     166,   167,   245,   237,   248,     0,   226,   227,   232,   236,
+       0,   171,     0,    92,    93,    62,    62,    57,     0,    27,
+       0,    26,    39,     0,    41,     0,    40,    45,     0,    50,
+       0,    53,     0,    74,    54,    55,     0,   115,     0,     0,
+       0,   110,     0,     0,   120,   144,     0,   118,     0,   142,
+     141,   146,   146,   146,   146,   206,   206,     0,     0,    89,
+      97,     0,     0,     0,     0,     0,   168,   252,   174,   172,
+     173,     0,     0,   183,    28,     0,    42,    46,     0,     0,
+      47,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     111,   117,     0,     0,     0,     0,     0,     0,   206,   206,
+       0,   162,   162,   162,   162,     0,     0,   154,    95,     0,
+       0,     0,   108,   104,    99,    58,    59,   184,    38,    62,
+      62,    43,    62,    51,    62,    75,   109,     0,   112,   143,
+     143,   143,   143,     0,     0,     0,   156,   157,   158,   159,
+     146,   146,    94,   106,   105,     0,    50,     0,     0,     0,
+     113,   141,   141,   141,   141,     0,     0,   133,   162,   162,
+     102,   107,   105,    48,    49,     0,     0,   135,   136,   137,
+     138,   143,   143,   160,   161,   103,    44,    52,   141,   141,
+     139,   140
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -424,  -424,    65,  -280,  -424,  -187,   -93,   194,   209,   214,
+    -424,   218,  -424,  -424,  -206,   262,  -301,   -72,  -369,  -424,
+    -424,   451,  -424,   268,    -2,    40,  -153,   288,   318,  -423,
+     323,  -170,  -424,   369,  -337,  -383,  -424,  -219,   -67,  -179,
+     -19,  -277,  -424,  -424,  -424,   -49,  -424,  -424,    -6,  -424,
+      17,    10,    16,  -111,  -424,   -24,   170,  -424,    64,  -424,
+    -424,   -30,  -105,   130,  -424,  -424,  -424,   128,  -424,   -45
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    28,   162,   333,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,   370,   420,    39,   376,   163,   274,    40,
+      41,    42,    43,    44,    45,    69,   159,    46,    47,   339,
+      48,   389,   322,    49,   440,   390,   324,   325,   326,   212,
+      50,   397,    51,    52,   229,   214,    84,    85,    53,    87,
+      88,    89,    90,    54,    91,   140,   141,   142,   248,   249,
+     250,   251,   143,    70,    92,    93,    94,   188,   189,   190
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      86,   330,    64,   281,    86,    86,    86,    86,    86,    86,
+      86,    86,    86,   363,    86,    86,    86,   231,    86,    86,
+     104,   105,   106,   107,   109,   197,   113,   116,   200,   311,
+     252,   203,   112,    55,   186,   119,   121,   179,   124,   127,
+     129,   130,   455,   456,   211,    65,   321,    96,    99,   102,
+     336,   168,    86,     2,     3,   401,    86,    86,   149,   176,
+     164,   500,   150,   144,   165,    29,   350,  -105,   152,   422,
+     169,   424,   153,    86,    86,   175,   128,   187,   351,   515,
+     154,   146,   337,   338,    86,    26,   491,   492,   493,   494,
+     418,   419,   213,   337,   338,   145,   172,   174,   155,    96,
+      99,   102,   177,   166,   219,   215,   191,   194,   151,    26,
+     233,    67,   264,   311,   253,   353,   354,   373,   504,   374,
+     204,   205,   230,   312,   453,   192,   375,   178,   518,   519,
+     378,   206,   278,   207,   421,   311,   374,    97,   100,   103,
+     186,   311,   311,   375,   252,   301,   114,   208,   263,   120,
+     327,   217,   384,   352,   507,   508,   509,   510,   388,    20,
+      21,    22,   218,   213,   476,   477,   478,   479,    24,    25,
+     484,   220,   441,   442,   443,   444,   215,   222,    86,   225,
+     226,   520,   521,   187,   277,   224,    86,    86,   156,   157,
+     158,   265,   266,   213,   423,   267,   374,   213,   213,   311,
+     282,   213,   276,   375,   177,   502,   215,   312,   288,   289,
+     215,   215,   131,   342,   215,   361,   432,   254,   279,   256,
+     283,   513,   514,   300,   366,   341,   340,   343,   383,   312,
+     346,   286,   347,   348,   457,   312,   312,   349,   254,   255,
+     256,   216,   271,   272,   273,   295,   385,   345,   221,   254,
+     275,   256,   386,   132,   133,   398,   399,   405,   256,   134,
+     135,   498,   499,   415,   136,   408,   137,   410,   413,  -229,
+    -229,  -229,   138,   426,   427,   428,    86,   139,   429,   433,
+     503,   213,   311,   311,   311,   311,   332,   447,   449,   451,
+     465,   270,   358,   312,   215,   467,   475,   480,    86,   505,
+     481,   495,    86,   213,    86,   286,   295,   496,   506,   213,
+     213,   147,   262,   344,   379,   407,   215,   284,   380,     0,
+       0,   287,   215,   215,   311,   311,   290,   382,     0,   291,
+       0,    86,   292,     0,   293,   296,   297,   298,     0,   406,
+     391,   392,   393,   394,   395,   396,     0,   328,   329,   409,
+       0,     0,   335,     0,   403,     0,     0,     0,   332,     0,
+       0,     0,   369,   372,     0,     0,     0,   213,     0,     0,
+       0,     0,   213,   213,   213,   213,   312,   312,   312,   312,
+     215,     0,     0,     0,     0,   215,   215,   215,   215,    86,
+      86,     0,     0,     0,   213,     0,     0,     0,     0,     0,
+     332,   355,   356,   357,     0,   445,   446,   215,     0,     0,
+     313,   434,   435,   436,   437,   438,   439,     0,   312,   312,
+     411,   412,     0,     0,     0,   314,     0,     0,     0,     0,
+     315,     0,    86,    86,   316,    97,   100,   103,     0,   381,
+       0,     0,     0,     0,     0,     0,     0,     0,   473,   474,
+     213,   213,   213,   213,     0,     0,    68,     0,    68,    68,
+      68,   213,   213,   215,   215,   215,   215,     0,   404,   332,
+       0,     0,   227,     0,   215,   215,     0,     0,   317,    20,
+      21,    22,     0,     0,   228,     0,     0,     0,    24,    25,
+     414,    26,   213,   213,   313,   416,   148,     0,   417,     0,
+       0,     0,     0,     0,   318,   215,   215,     0,    68,   314,
+      68,    68,    68,   430,   315,   332,   313,     0,   316,     0,
+       0,     0,   313,   313,   486,   487,     0,   488,   448,   489,
+       0,   314,   450,     0,   319,   454,   315,   314,   314,   320,
+     316,     0,   315,   315,     0,   458,   316,   316,   459,   460,
+     332,   461,   462,   463,   464,     0,   466,   287,   296,   335,
+       0,     0,   317,   468,   469,   470,   471,   472,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   482,
+     313,   485,     0,     0,   317,   323,     0,     0,   318,     0,
+     317,   317,     0,     0,     0,   314,     0,   490,     0,     0,
+     315,     0,     0,     0,   316,   497,     0,   268,   269,     0,
+     318,     0,     0,     0,     0,     0,   318,   318,   319,     0,
+       0,     0,     0,   320,     0,   511,   512,     0,     0,     0,
+       0,     0,     0,     0,     0,   516,   517,     0,     0,     0,
+     319,     0,    68,     0,     0,   320,   319,   319,   317,     0,
+       0,   320,   320,     0,     0,     0,    68,     0,     0,   299,
+       0,     0,     0,   313,   313,   313,   313,     0,     0,   323,
+       0,     0,     0,   334,   318,     0,     0,     0,   314,   314,
+     314,   314,     0,   315,   315,   315,   315,   316,   316,   316,
+     316,   323,     0,     0,     0,     0,   180,   323,   323,   181,
+     182,     0,     0,     0,   319,   313,   313,     0,     0,   320,
+       0,     0,     0,     0,     0,     0,    68,    68,   334,     0,
+     314,   314,     0,     0,     0,   315,   315,     0,     0,   316,
+     316,   317,   317,   317,   317,     0,   183,     0,     0,   177,
+       0,     0,    20,    21,    22,     0,   184,     0,     0,     0,
+       0,    24,    25,     0,     0,   323,     0,   318,   318,   318,
+     318,   209,   210,   182,     0,   185,     0,     0,     0,     0,
+       0,     0,     0,   317,   317,     0,     0,     0,     0,     0,
+       0,     0,    17,     0,     0,     0,     0,   319,   319,   319,
+     319,     0,   320,   320,   320,   320,     0,     0,     0,   318,
+     318,     0,     0,     0,     0,    20,    21,    22,     0,   184,
+       0,     0,     0,     0,    24,    25,     0,     0,     0,   280,
+       0,   209,   210,   182,     0,     0,     0,   425,     0,   319,
+     319,     0,     0,     0,   320,   320,  -181,     0,   323,   323,
+     323,   323,    17,  -181,  -181,  -181,  -181,  -181,  -181,     0,
+       0,    65,     0,     0,     0,    71,    72,    73,     0,  -181,
+       0,     0,  -181,     0,     0,    20,    21,    22,     0,   184,
+       0,     0,     0,     0,    24,    25,     0,     0,     0,     0,
+     323,   323,     0,     0,     0,  -181,    74,    75,  -181,    76,
+      77,    78,     0,     0,     0,    79,    80,    20,    21,    22,
+       0,     0,     0,     0,  -206,   108,    24,    25,     0,    71,
+      72,    73,     0,     0,     0,   132,   133,    67,    81,    82,
+      83,   134,   135,     0,     0,     0,   136,     0,   137,     0,
+       0,   110,     0,     0,   138,    71,    72,    73,     0,   139,
+      74,    75,     0,    76,    77,    78,     0,     0,     0,    79,
+      80,    20,    21,    22,     0,     0,     0,     0,  -206,     0,
+      24,    25,     0,     0,     0,     0,    74,    75,     0,    76,
+      77,    78,    81,    82,    83,    79,    80,    20,    21,    22,
+       0,     0,     0,     0,   111,   115,    24,    25,     0,    71,
+      72,    73,     0,     0,     0,     0,     0,     0,    81,    82,
+      83,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   117,     0,     0,     0,    71,    72,    73,     0,     0,
+      74,    75,     0,    76,    77,    78,     0,     0,     0,    79,
+      80,    20,    21,    22,     0,     0,     0,     0,  -206,     0,
+      24,    25,     0,     0,     0,     0,    74,    75,     0,    76,
+      77,    78,    81,    82,    83,    79,    80,    20,    21,    22,
+       0,     0,     0,     0,   118,   122,    24,    25,     0,    71,
+      72,    73,     0,     0,     0,     0,     0,     0,    81,    82,
+      83,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   125,     0,     0,     0,    71,    72,    73,     0,     0,
+      74,    75,     0,    76,    77,    78,     0,     0,     0,    79,
+      80,    20,    21,    22,     0,     0,     0,     0,   123,     0,
+      24,    25,     0,     0,   181,   182,    74,    75,     0,    76,
+      77,    78,    81,    82,    83,    79,    80,    20,    21,    22,
+       0,     0,     0,   126,   170,     0,    24,    25,    71,    72,
+      73,     0,     0,     0,     0,     0,     0,     0,    81,    82,
+      83,   183,     0,     0,   177,     0,     0,    20,    21,    22,
+       0,   184,     0,     0,     0,     0,    24,    25,     0,    74,
+      75,     0,    76,    77,    78,     0,     0,     0,    79,    80,
+      20,    21,    22,     0,     0,     0,     0,   171,     0,    24,
+      25,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    81,    82,    83,    -3,     1,     0,     2,     3,     4,
+       0,     0,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,     0,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   483,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,    -8,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,    -8,    -8,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   501,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,    -8,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,    -8,    -8,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   160,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,   161,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   195,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,   196,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   198,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,   199,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   201,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,   202,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   331,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,    -8,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   359,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,   360,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   362,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,    -8,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   364,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,   365,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   367,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,   368,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   400,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,    -8,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   452,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,    -8,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   223,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,     0,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   371,    27,     2,     3,     4,
+       0,   -62,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,     0,     0,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,   234,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,    56,    27,     2,     3,     4,
+       0,   -62,    57,    58,    59,    60,    61,     0,    62,     0,
+    -163,  -163,  -163,     0,  -163,    14,   235,   133,  -163,     0,
+       0,  -163,   236,     0,     0,    63,     0,   237,   238,     0,
+       0,     0,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   302,    27,   209,   210,   182,
+       0,  -163,   303,   304,   305,   306,   307,     0,   308,     0,
+       0,     0,   309,    13,     0,     0,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,   310,    19,     0,     0,     0,
+       0,     0,     0,    65,     0,   209,   210,   182,     0,     0,
+       0,    20,    21,    22,     0,   184,     0,     0,     0,     0,
+      24,    25,     0,     0,     0,    65,    17,     2,     3,     4,
+       0,  -146,    57,    58,    59,    60,    61,     0,    62,     0,
+       0,     0,    66,     0,     0,    14,     0,     0,    17,    20,
+      21,    22,     0,   184,     0,    63,     0,     0,    24,    25,
+       0,     0,   167,     0,     0,     0,     0,     0,     0,    67,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,    65,    27,     2,     3,     4,
+       0,    67,    57,    58,    59,    60,    61,     0,    62,     0,
+       0,     0,    95,   132,   133,    14,     0,     0,    17,   134,
+     135,     0,     0,     0,   136,    63,   137,     0,     0,  -229,
+    -229,  -229,   138,     0,     0,   232,     0,   139,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,    65,    27,     2,     3,     4,
+       0,    67,    57,    58,    59,    60,    61,     0,    62,     0,
+       0,     0,    98,     0,     0,    14,   132,   133,    17,     0,
+       0,     0,   134,   135,     0,    63,     0,   136,  -229,   137,
+       0,     0,  -229,     0,  -229,   138,     0,     0,     0,     0,
+     139,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,    65,    27,     2,     3,     4,
+       0,    67,    57,    58,    59,    60,    61,     0,    62,     0,
+     235,   133,   101,     0,     0,    14,   236,     0,    17,     0,
+       0,     0,   238,     0,     0,    63,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,    65,    27,     2,     3,     4,
+       0,    67,    57,    58,    59,    60,    61,     0,    62,     0,
+     132,   133,   285,     0,     0,    14,   134,   135,    17,     0,
+       0,   136,     0,   137,     0,    63,     0,     0,     0,   257,
+     258,   259,   260,   261,   139,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,    65,    27,     2,     3,     4,
+       0,    67,    57,    58,    59,    60,    61,     0,    62,     0,
+     235,     0,   294,     0,     0,    14,   236,     0,    17,     0,
+       0,     0,   238,     0,     0,    63,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,   377,    27,   209,   210,   182,
+       0,    67,   303,   304,   305,   306,   307,     0,   308,     0,
+       0,     0,     0,    13,     0,     0,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,   310,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,   184,     0,     0,     0,     0,
+      24,    25,     0,     0,     0,   387,     0,   209,   210,   182,
+       0,  -146,   303,   304,   305,   306,   307,     0,   308,     0,
+       0,     0,     0,    13,     0,     0,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,   310,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,   184,     0,     0,     0,     0,
+      24,    25,     0,     0,     0,   431,     0,   209,   210,   182,
+       0,  -146,   303,   304,   305,   306,   307,     0,   308,     0,
+       0,     0,     0,    13,     0,     0,    15,    16,    17,     0,
+       0,     0,     0,     0,     0,   310,    19,     0,     2,     3,
+       4,     0,     0,    57,    58,    59,    60,    61,     0,    62,
+       0,    20,    21,    22,     0,   184,    14,     0,     0,    17,
+      24,    25,     0,     0,     0,    65,    63,     2,     3,     4,
+       0,  -146,    57,    58,    59,    60,    61,     0,    62,     0,
+       0,     0,    20,    21,    22,    14,    23,     0,    17,     0,
+       0,    24,    25,     0,    26,    63,     0,    27,     0,     0,
+       0,    71,    72,    73,     0,     0,     0,     0,     0,     0,
+       0,    20,    21,    22,     0,    23,     0,     0,     0,     0,
+      24,    25,     0,    26,     0,     0,    27,     0,     0,     0,
+       0,    67,    74,    75,   192,    76,    77,    78,    71,    72,
+      73,    79,    80,    20,    21,    22,     0,     0,     0,     0,
+       0,     0,    24,    25,     0,     0,     0,     0,     0,     0,
+       0,     0,   193,     0,    81,    82,    83,     0,     0,    74,
+      75,     0,    76,    77,    78,    71,    72,    73,    79,    80,
+      20,    21,    22,     0,     0,     0,   173,     0,     0,    24,
+      25,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    81,    82,    83,     0,     0,    74,    75,   192,    76,
+      77,    78,    71,    72,    73,    79,    80,    20,    21,    22,
+       0,     0,     0,     0,     0,     0,    24,    25,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    81,    82,
+      83,     0,     0,    74,    75,     0,    76,    77,    78,    71,
+      72,    73,    79,    80,    20,    21,    22,     0,     0,     0,
+       0,   402,     0,    24,    25,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    81,    82,    83,     0,     0,
+      74,    75,     0,    76,    77,    78,     0,     0,     0,    79,
+      80,    20,    21,    22,     0,     0,     0,     0,     0,     0,
+      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    81,    82,    83,     2,     3,     4,     0,     0,
+       5,     6,     7,     8,     9,    10,    11,    12,     0,     0,
+       0,    13,     0,    14,    15,    16,    17,     0,     0,     0,
+       0,     0,     0,    18,    19,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    20,
+      21,    22,     0,    23,     0,     0,     0,     0,    24,    25,
+       0,    26,     0,     0,    27,   209,   210,   182,     0,   -62,
+     303,   304,   305,   306,   307,     0,   308,     0,     0,     0,
+       0,    13,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,     0,     0,   310,    19,     0,     2,     3,     4,     0,
+       0,     5,     6,     7,     8,     9,    10,    11,    12,    20,
+      21,    22,    13,   184,    14,    15,    16,    17,    24,    25,
+       0,     0,     0,     0,    18,    19,     0,     0,     0,  -146,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,    21,    22,     0,    23,     0,     0,     0,     0,    24,
+      25,     0,    26,     0,     0,    27,     2,     3,     4,     0,
+       0,    57,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,    66,     0,     0,    14,     0,     0,    17,     0,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,    21,    22,     0,    23,     0,     0,     0,     0,    24,
+      25,     0,    26,     0,     0,    27,     2,     3,     4,     0,
+       0,    57,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,    95,     0,     0,    14,     0,     0,    17,     0,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,    21,    22,     0,    23,     0,     0,     0,     0,    24,
+      25,     0,    26,     0,     0,    27,     2,     3,     4,     0,
+       0,    57,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,    98,     0,     0,    14,     0,     0,    17,     0,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,    21,    22,     0,    23,     0,     0,     0,     0,    24,
+      25,     0,    26,     0,     0,    27,     2,     3,     4,     0,
+       0,    57,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,   101,     0,     0,    14,     0,     0,    17,     0,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,    21,    22,     0,    23,     0,     0,     0,     0,    24,
+      25,     0,    26,     0,     0,    27,     2,     3,     4,     0,
+       0,    57,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,   285,     0,     0,    14,     0,     0,    17,     0,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,    21,    22,     0,    23,     0,     0,     0,     0,    24,
+      25,     0,    26,     0,     0,    27,     2,     3,     4,     0,
+       0,    57,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,   294,     0,     0,    14,     0,     0,    17,     0,     0,
+       2,     3,     4,     0,    63,    57,    58,    59,    60,    61,
+       0,    62,     0,     0,     0,     0,     0,     0,    14,     0,
+      20,    21,    22,     0,    23,     0,     0,     0,    63,    24,
+      25,     0,    26,     0,     0,    27,     0,     0,     0,     0,
+       0,     0,     0,     0,    20,    21,    22,     0,    23,     0,
+       0,     0,     0,    24,    25,     0,    26,     0,     0,    27
+};
+
+static const yytype_int16 yycheck[] =
+{
+       6,   220,     4,   182,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,   293,    20,    21,    22,   128,    24,    25,
+      10,    11,    12,    13,    14,    97,    16,    17,   100,   216,
+     135,   103,    15,    67,    83,    18,    20,    82,    21,    22,
+      24,    25,   411,   412,   111,     1,   216,     7,     8,     9,
+       1,    75,    58,     3,     4,   335,    62,    63,     1,     1,
+       1,   484,     5,     0,     5,     0,    40,    18,    58,   370,
+      76,   372,    62,    79,    80,    81,     5,    83,    52,   502,
+      63,    67,    33,    34,    90,    59,   469,   470,   471,   472,
+      16,    17,   111,    33,    34,    30,    79,    80,    67,    59,
+      60,    61,    44,    44,     1,   111,    54,    90,    51,    59,
+     134,    67,     5,   300,   138,   268,   269,    18,   487,    20,
+      54,    54,   128,   216,   404,    38,    27,    69,   511,   512,
+     300,    54,   177,    54,    18,   322,    20,     7,     8,     9,
+     189,   328,   329,    27,   249,   212,    16,    54,   150,    19,
+     217,    54,   322,   264,   491,   492,   493,   494,   328,    47,
+      48,    49,    54,   182,   441,   442,   443,   444,    56,    57,
+     450,    54,   391,   392,   393,   394,   182,    54,   184,    54,
+      53,   518,   519,   189,    53,   120,   192,   193,    16,    17,
+      18,    54,    54,   212,    18,    54,    20,   216,   217,   386,
+     184,   220,    54,    27,    44,   485,   212,   300,   192,   193,
+     216,   217,     1,    54,   220,   287,   386,    58,    69,    60,
+      70,   498,   499,    67,   296,    52,   228,    53,    18,   322,
+     254,   191,   256,   257,   413,   328,   329,   261,    58,    59,
+      60,   111,    16,    17,    18,   205,    67,    55,   118,    58,
+      59,    60,    67,    42,    43,    18,    18,    18,    60,    48,
+      49,   480,   481,    18,    53,    52,    55,    52,    52,    58,
+      59,    60,    61,    18,    54,    54,   282,    66,    54,    18,
+     486,   300,   469,   470,   471,   472,   221,    18,    18,    54,
+      18,   161,   282,   386,   300,    18,    18,    54,   304,    18,
+      54,    54,   308,   322,   310,   265,   266,    54,    18,   328,
+     329,    43,   142,   249,   304,   345,   322,   189,   308,    -1,
+      -1,   191,   328,   329,   511,   512,   196,   310,    -1,   199,
+      -1,   337,   202,    -1,   204,   205,   206,   207,    -1,   341,
+      25,    26,    27,    28,    29,    30,    -1,   217,   218,   351,
+      -1,    -1,   222,    -1,   337,    -1,    -1,    -1,   293,    -1,
+      -1,    -1,   297,   298,    -1,    -1,    -1,   386,    -1,    -1,
+      -1,    -1,   391,   392,   393,   394,   469,   470,   471,   472,
+     386,    -1,    -1,    -1,    -1,   391,   392,   393,   394,   395,
+     396,    -1,    -1,    -1,   413,    -1,    -1,    -1,    -1,    -1,
+     335,   271,   272,   273,    -1,   395,   396,   413,    -1,    -1,
+     216,    25,    26,    27,    28,    29,    30,    -1,   511,   512,
+     355,   356,    -1,    -1,    -1,   216,    -1,    -1,    -1,    -1,
+     216,    -1,   438,   439,   216,   305,   306,   307,    -1,   309,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   438,   439,
+     469,   470,   471,   472,    -1,    -1,     5,    -1,     7,     8,
+       9,   480,   481,   469,   470,   471,   472,    -1,   338,   404,
+      -1,    -1,    40,    -1,   480,   481,    -1,    -1,   216,    47,
+      48,    49,    -1,    -1,    52,    -1,    -1,    -1,    56,    57,
+     360,    59,   511,   512,   300,   365,    45,    -1,   368,    -1,
+      -1,    -1,    -1,    -1,   216,   511,   512,    -1,    57,   300,
+      59,    60,    61,   383,   300,   450,   322,    -1,   300,    -1,
+      -1,    -1,   328,   329,   459,   460,    -1,   462,   398,   464,
+      -1,   322,   402,    -1,   216,   405,   322,   328,   329,   216,
+     322,    -1,   328,   329,    -1,   415,   328,   329,   418,   419,
+     485,   421,   422,   423,   424,    -1,   426,   427,   428,   429,
+      -1,    -1,   300,   433,   434,   435,   436,   437,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   449,
+     386,   451,    -1,    -1,   322,   216,    -1,    -1,   300,    -1,
+     328,   329,    -1,    -1,    -1,   386,    -1,   467,    -1,    -1,
+     386,    -1,    -1,    -1,   386,   475,    -1,   156,   157,    -1,
+     322,    -1,    -1,    -1,    -1,    -1,   328,   329,   300,    -1,
+      -1,    -1,    -1,   300,    -1,   495,   496,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   505,   506,    -1,    -1,    -1,
+     322,    -1,   191,    -1,    -1,   322,   328,   329,   386,    -1,
+      -1,   328,   329,    -1,    -1,    -1,   205,    -1,    -1,   208,
+      -1,    -1,    -1,   469,   470,   471,   472,    -1,    -1,   300,
+      -1,    -1,    -1,   222,   386,    -1,    -1,    -1,   469,   470,
+     471,   472,    -1,   469,   470,   471,   472,   469,   470,   471,
+     472,   322,    -1,    -1,    -1,    -1,     1,   328,   329,     4,
+       5,    -1,    -1,    -1,   386,   511,   512,    -1,    -1,   386,
+      -1,    -1,    -1,    -1,    -1,    -1,   265,   266,   267,    -1,
+     511,   512,    -1,    -1,    -1,   511,   512,    -1,    -1,   511,
+     512,   469,   470,   471,   472,    -1,    41,    -1,    -1,    44,
+      -1,    -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    57,    -1,    -1,   386,    -1,   469,   470,   471,
+     472,     3,     4,     5,    -1,    70,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   511,   512,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    24,    -1,    -1,    -1,    -1,   469,   470,   471,
+     472,    -1,   469,   470,   471,   472,    -1,    -1,    -1,   511,
+     512,    -1,    -1,    -1,    -1,    47,    48,    49,    -1,    51,
+      -1,    -1,    -1,    -1,    56,    57,    -1,    -1,    -1,     1,
+      -1,     3,     4,     5,    -1,    -1,    -1,   376,    -1,   511,
+     512,    -1,    -1,    -1,   511,   512,    18,    -1,   469,   470,
+     471,   472,    24,    25,    26,    27,    28,    29,    30,    -1,
+      -1,     1,    -1,    -1,    -1,     5,     6,     7,    -1,    41,
+      -1,    -1,    44,    -1,    -1,    47,    48,    49,    -1,    51,
+      -1,    -1,    -1,    -1,    56,    57,    -1,    -1,    -1,    -1,
+     511,   512,    -1,    -1,    -1,    67,    36,    37,    70,    39,
+      40,    41,    -1,    -1,    -1,    45,    46,    47,    48,    49,
+      -1,    -1,    -1,    -1,    54,     1,    56,    57,    -1,     5,
+       6,     7,    -1,    -1,    -1,    42,    43,    67,    68,    69,
+      70,    48,    49,    -1,    -1,    -1,    53,    -1,    55,    -1,
+      -1,     1,    -1,    -1,    61,     5,     6,     7,    -1,    66,
+      36,    37,    -1,    39,    40,    41,    -1,    -1,    -1,    45,
+      46,    47,    48,    49,    -1,    -1,    -1,    -1,    54,    -1,
+      56,    57,    -1,    -1,    -1,    -1,    36,    37,    -1,    39,
+      40,    41,    68,    69,    70,    45,    46,    47,    48,    49,
+      -1,    -1,    -1,    -1,    54,     1,    56,    57,    -1,     5,
+       6,     7,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     1,    -1,    -1,    -1,     5,     6,     7,    -1,    -1,
+      36,    37,    -1,    39,    40,    41,    -1,    -1,    -1,    45,
+      46,    47,    48,    49,    -1,    -1,    -1,    -1,    54,    -1,
+      56,    57,    -1,    -1,    -1,    -1,    36,    37,    -1,    39,
+      40,    41,    68,    69,    70,    45,    46,    47,    48,    49,
+      -1,    -1,    -1,    -1,    54,     1,    56,    57,    -1,     5,
+       6,     7,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     1,    -1,    -1,    -1,     5,     6,     7,    -1,    -1,
+      36,    37,    -1,    39,    40,    41,    -1,    -1,    -1,    45,
+      46,    47,    48,    49,    -1,    -1,    -1,    -1,    54,    -1,
+      56,    57,    -1,    -1,     4,     5,    36,    37,    -1,    39,
+      40,    41,    68,    69,    70,    45,    46,    47,    48,    49,
+      -1,    -1,    -1,    53,     1,    -1,    56,    57,     5,     6,
+       7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    41,    -1,    -1,    44,    -1,    -1,    47,    48,    49,
+      -1,    51,    -1,    -1,    -1,    -1,    56,    57,    -1,    36,
+      37,    -1,    39,    40,    41,    -1,    -1,    -1,    45,    46,
+      47,    48,    49,    -1,    -1,    -1,    -1,    54,    -1,    56,
+      57,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    70,     0,     1,    -1,     3,     4,     5,
+      -1,    -1,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    -1,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    33,    34,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    33,    34,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    -1,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    13,    14,    15,
+      -1,    -1,    -1,    19,    -1,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      16,    17,    18,    -1,    20,    21,    42,    43,    24,    -1,
+      -1,    27,    48,    -1,    -1,    31,    -1,    53,    54,    -1,
+      -1,    -1,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    18,    19,    -1,    -1,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,     1,    -1,     3,     4,     5,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    -1,     1,    24,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    18,    -1,    -1,    21,    -1,    -1,    24,    47,
+      48,    49,    -1,    51,    -1,    31,    -1,    -1,    56,    57,
+      -1,    -1,     1,    -1,    -1,    -1,    -1,    -1,    -1,    67,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    18,    42,    43,    21,    -1,    -1,    24,    48,
+      49,    -1,    -1,    -1,    53,    31,    55,    -1,    -1,    58,
+      59,    60,    61,    -1,    -1,     1,    -1,    66,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    18,    -1,    -1,    21,    42,    43,    24,    -1,
+      -1,    -1,    48,    49,    -1,    31,    -1,    53,    54,    55,
+      -1,    -1,    58,    -1,    60,    61,    -1,    -1,    -1,    -1,
+      66,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      42,    43,    18,    -1,    -1,    21,    48,    -1,    24,    -1,
+      -1,    -1,    54,    -1,    -1,    31,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      42,    43,    18,    -1,    -1,    21,    48,    49,    24,    -1,
+      -1,    53,    -1,    55,    -1,    31,    -1,    -1,    -1,    61,
+      62,    63,    64,    65,    66,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      42,    -1,    18,    -1,    -1,    21,    48,    -1,    24,    -1,
+      -1,    -1,    54,    -1,    -1,    31,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,     1,    62,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    -1,    19,    -1,    -1,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    -1,     1,    -1,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    -1,    19,    -1,    -1,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    -1,     1,    -1,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    -1,    19,    -1,    -1,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    31,    32,    -1,     3,     4,
+       5,    -1,    -1,     8,     9,    10,    11,    12,    -1,    14,
+      -1,    47,    48,    49,    -1,    51,    21,    -1,    -1,    24,
+      56,    57,    -1,    -1,    -1,     1,    31,     3,     4,     5,
+      -1,    67,     8,     9,    10,    11,    12,    -1,    14,    -1,
+      -1,    -1,    47,    48,    49,    21,    51,    -1,    24,    -1,
+      -1,    56,    57,    -1,    59,    31,    -1,    62,    -1,    -1,
+      -1,     5,     6,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,    -1,    62,    -1,    -1,    -1,
+      -1,    67,    36,    37,    38,    39,    40,    41,     5,     6,
+       7,    45,    46,    47,    48,    49,    -1,    -1,    -1,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    66,    -1,    68,    69,    70,    -1,    -1,    36,
+      37,    -1,    39,    40,    41,     5,     6,     7,    45,    46,
+      47,    48,    49,    -1,    -1,    -1,    53,    -1,    -1,    56,
+      57,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    70,    -1,    -1,    36,    37,    38,    39,
+      40,    41,     5,     6,     7,    45,    46,    47,    48,    49,
+      -1,    -1,    -1,    -1,    -1,    -1,    56,    57,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    -1,    -1,    36,    37,    -1,    39,    40,    41,     5,
+       6,     7,    45,    46,    47,    48,    49,    -1,    -1,    -1,
+      -1,    54,    -1,    56,    57,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    68,    69,    70,    -1,    -1,
+      36,    37,    -1,    39,    40,    41,    -1,    -1,    -1,    45,
+      46,    47,    48,    49,    -1,    -1,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    70,     3,     4,     5,    -1,    -1,
+       8,     9,    10,    11,    12,    13,    14,    15,    -1,    -1,
+      -1,    19,    -1,    21,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    -1,    31,    32,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    47,
+      48,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,    57,
+      -1,    59,    -1,    -1,    62,     3,     4,     5,    -1,    67,
+       8,     9,    10,    11,    12,    -1,    14,    -1,    -1,    -1,
+      -1,    19,    -1,    -1,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    -1,    31,    32,    -1,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    11,    12,    13,    14,    15,    47,
+      48,    49,    19,    51,    21,    22,    23,    24,    56,    57,
+      -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      57,    -1,    59,    -1,    -1,    62,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    11,    12,    -1,    14,    -1,    -1,
+      -1,    18,    -1,    -1,    21,    -1,    -1,    24,    -1,    -1,
+      -1,    -1,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      57,    -1,    59,    -1,    -1,    62,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    11,    12,    -1,    14,    -1,    -1,
+      -1,    18,    -1,    -1,    21,    -1,    -1,    24,    -1,    -1,
+      -1,    -1,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      57,    -1,    59,    -1,    -1,    62,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    11,    12,    -1,    14,    -1,    -1,
+      -1,    18,    -1,    -1,    21,    -1,    -1,    24,    -1,    -1,
+      -1,    -1,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      57,    -1,    59,    -1,    -1,    62,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    11,    12,    -1,    14,    -1,    -1,
+      -1,    18,    -1,    -1,    21,    -1,    -1,    24,    -1,    -1,
+      -1,    -1,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      57,    -1,    59,    -1,    -1,    62,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    11,    12,    -1,    14,    -1,    -1,
+      -1,    18,    -1,    -1,    21,    -1,    -1,    24,    -1,    -1,
+      -1,    -1,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      47,    48,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      57,    -1,    59,    -1,    -1,    62,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    11,    12,    -1,    14,    -1,    -1,
+      -1,    18,    -1,    -1,    21,    -1,    -1,    24,    -1,    -1,
+       3,     4,     5,    -1,    31,     8,     9,    10,    11,    12,
+      -1,    14,    -1,    -1,    -1,    -1,    -1,    -1,    21,    -1,
+      47,    48,    49,    -1,    51,    -1,    -1,    -1,    31,    56,
+      57,    -1,    59,    -1,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    47,    48,    49,    -1,    51,    -1,
+      -1,    -1,    -1,    56,    57,    -1,    59,    -1,    -1,    62
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,     1,     3,     4,     5,     8,     9,    10,    11,    12,
+      13,    14,    15,    19,    21,    22,    23,    24,    31,    32,
+      47,    48,    49,    51,    56,    57,    59,    62,    72,    73,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    86,
+      90,    91,    92,    93,    94,    95,    98,    99,   101,   104,
+     111,   113,   114,   119,   124,    67,     1,     8,     9,    10,
+      11,    12,    14,    31,    95,     1,    18,    67,    92,    96,
+     134,     5,     6,     7,    36,    37,    39,    40,    41,    45,
+      46,    68,    69,    70,   117,   118,   119,   120,   121,   122,
+     123,   125,   135,   136,   137,    18,    96,   134,    18,    96,
+     134,    18,    96,   134,   122,   122,   122,   122,     1,   122,
+       1,    54,   121,   122,   134,     1,   122,     1,    54,   121,
+     134,   123,     1,    54,   121,     1,    53,   121,     5,   123,
+     123,     1,    42,    43,    48,    49,    53,    55,    61,    66,
+     126,   127,   128,   133,     0,    73,    67,    94,    92,     1,
+       5,    51,   122,   122,   121,    67,    16,    17,    18,    97,
+       1,    18,    73,    88,     1,     5,    44,     1,   126,   119,
+       1,    54,   121,    53,   121,   119,     1,    44,    69,   140,
+       1,     4,     5,    41,    51,    70,   116,   119,   138,   139,
+     140,    54,    38,    66,   121,     1,    18,    88,     1,    18,
+      88,     1,    18,    88,    54,    54,    54,    54,    54,     3,
+       4,   109,   110,   111,   116,   119,   134,    54,    54,     1,
+      54,   134,    54,     1,    73,    54,    53,    40,    52,   115,
+     119,   124,     1,   126,     1,    42,    48,    53,    54,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,   129,   130,
+     131,   132,   133,   126,    58,    59,    60,    61,    62,    63,
+      64,    65,   127,    95,     5,    54,    54,    54,    92,    92,
+     134,    16,    17,    18,    89,    59,    54,    53,   140,    69,
+       1,   110,   123,    70,   138,    18,    96,   134,   123,   123,
+     134,   134,   134,   134,    18,    96,   134,   134,   134,    92,
+      67,   109,     1,     8,     9,    10,    11,    12,    14,    18,
+      31,    76,    77,    78,    79,    80,    82,    86,    98,    99,
+     101,   102,   103,   104,   107,   108,   109,   109,   134,   134,
+     108,     1,    73,    74,    92,   134,     1,    33,    34,   100,
+      95,    52,    54,    53,   129,    55,   126,   126,   126,   126,
+      40,    52,   124,    97,    97,   134,   134,   134,   122,     1,
+      18,    88,     1,    74,     1,    18,    88,     1,    18,    73,
+      84,     1,    73,    18,    20,    27,    87,     1,   102,   122,
+     122,   134,   121,    18,   102,    67,    67,     1,   102,   102,
+     106,    25,    26,    27,    28,    29,    30,   112,    18,    18,
+       1,    74,    54,   121,   134,    18,    95,   132,    52,    95,
+      52,    73,    73,    52,   134,    18,   134,   134,    16,    17,
+      85,    18,    87,    18,    87,    92,    18,    54,    54,    54,
+     134,     1,   102,    18,    25,    26,    27,    28,    29,    30,
+     105,   108,   108,   108,   108,   122,   122,    18,   134,    18,
+     134,    54,     1,    74,   134,    89,    89,   110,   134,   134,
+     134,   134,   134,   134,   134,    18,   134,    18,   134,   134,
+     134,   134,   134,   122,   122,    18,   112,   112,   112,   112,
+      54,    54,   134,     1,    74,   134,    73,    73,    73,    73,
+     134,   106,   106,   106,   106,    54,    54,   134,   108,   108,
+     100,     1,    74,    85,    89,    18,    18,   105,   105,   105,
+     105,   134,   134,   112,   112,   100,   134,   134,   106,   106,
+     105,   105
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    71,    72,    72,    72,    73,    73,    74,    74,    75,
+      75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+      75,    75,    75,    76,    76,    76,    77,    77,    77,    78,
+      78,    78,    79,    79,    79,    80,    80,    80,    81,    81,
+      82,    82,    82,    83,    83,    83,    83,    84,    85,    85,
+      85,    86,    86,    86,    87,    87,    88,    89,    89,    89,
+      90,    91,    91,    92,    92,    92,    93,    93,    93,    94,
+      94,    95,    95,    95,    95,    95,    95,    95,    95,    95,
+      95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
+      96,    97,    97,    97,    98,    98,    98,    98,    98,    99,
+      99,    99,   100,   100,   100,   100,   100,   100,   100,   101,
+     101,   101,   101,   101,   101,   101,   101,   101,   101,   102,
+     102,   103,   103,   103,   103,   103,   103,   103,   103,   103,
+     103,   103,   103,   104,   104,   105,   105,   105,   105,   105,
+     105,   105,   106,   106,   107,   108,   108,   109,   109,   110,
+     110,   110,   110,   110,   111,   111,   112,   112,   112,   112,
+     112,   112,   112,   113,   113,   113,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   113,   114,   115,   115,
+     115,   116,   116,   116,   116,   116,   117,   118,   119,   119,
+     119,   119,   119,   119,   119,   119,   119,   120,   120,   120,
+     120,   120,   121,   121,   121,   122,   122,   123,   123,   123,
+     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+     123,   124,   124,   125,   125,   126,   126,   126,   126,   126,
+     127,   127,   127,   128,   128,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   128,   128,   128,   129,   129,   130,
+     130,   130,   131,   132,   132,   132,   132,   132,   132,   132,
+     132,   132,   132,   132,   132,   133,   134,   134,   135,   135,
+     135,   136,   136,   136,   137,   137,   137,   138,   138,   139,
+     139,   139,   139,   139,   140,   140
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     2,     1,     2,     1,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     3,     4,     5,     5,     6,     3,
+       3,     4,     3,     3,     4,     3,     3,     4,     7,     5,
+       5,     5,     6,     7,    10,     5,     6,     2,     4,     4,
+       0,     7,    10,     5,     1,     1,     2,     2,     4,     4,
+       2,     1,     0,     1,     2,     1,     1,     1,     1,     1,
+       2,     1,     1,     1,     5,     7,     2,     2,     2,     4,
+       4,     2,     2,     2,     2,     2,     2,     4,     4,     5,
+       2,     1,     3,     3,     7,     6,     2,     5,     4,     6,
+       3,     4,     5,     6,     3,     0,     4,     5,     3,     7,
+       5,     6,     7,     8,     2,     5,     4,     6,     5,     1,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     8,     3,     4,     4,     4,     4,     6,
+       6,     0,     1,     0,     2,     1,     0,     1,     2,     1,
+       1,     1,     1,     1,     6,     2,     3,     3,     3,     3,
+       5,     5,     0,     1,     2,     3,     4,     4,     5,     2,
+       3,     4,     5,     5,     5,     2,     2,     1,     1,     1,
+       1,     1,     2,     4,     5,     2,     2,     2,     3,     2,
+       3,     2,     2,     2,     2,     2,     2,     3,     3,     2,
+       2,     2,     1,     2,     3,     1,     0,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     3,     2,     3,     2,     1,     3,     3,     2,     0,
+       1,     2,     3,     2,     2,     2,     3,     3,     2,     2,
+       1,     1,     1,     1,     1,     3,     2,     1,     2,     1,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     2,     2,     3,
+       2,     2,     2,     2,     2,     3,     2,     1,     2,     1,
+       1,     1,     1,     1,     1,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* spec: clauses  */
+#line 113 "parser.y"
+                                { parsed_spec = (yyvsp[0].val); }
+#line 2367 "y.tab.c"
+    break;
+
+  case 3: /* spec: %empty  */
+#line 114 "parser.y"
+                                { parsed_spec = nil; }
+#line 2373 "y.tab.c"
+    break;
+
+  case 4: /* spec: error '\n'  */
+#line 115 "parser.y"
+                                { parsed_spec = nil;
+                                  if (errors >= 8)
+                                    YYABORT;
+                                  yyerrok;
+                                  yybadtoken(yychar, nil); }
+#line 2383 "y.tab.c"
+    break;
+
+  case 5: /* clauses: clause  */
+#line 123 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 2389 "y.tab.c"
+    break;
+
+  case 6: /* clauses: clause clauses  */
+#line 124 "parser.y"
+                                { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val));  }
+#line 2395 "y.tab.c"
+    break;
+
+  case 7: /* clauses_opt: clauses  */
+#line 127 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 2401 "y.tab.c"
+    break;
+
+  case 8: /* clauses_opt: %empty  */
+#line 128 "parser.y"
+                                { (yyval.val) = nil; }
+#line 2407 "y.tab.c"
+    break;
+
+  case 9: /* clause: all_clause  */
+#line 131 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2413 "y.tab.c"
+    break;
+
+  case 10: /* clause: some_clause  */
+#line 132 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2419 "y.tab.c"
+    break;
+
+  case 11: /* clause: none_clause  */
+#line 133 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2425 "y.tab.c"
+    break;
+
+  case 12: /* clause: maybe_clause  */
+#line 134 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2431 "y.tab.c"
+    break;
+
+  case 13: /* clause: cases_clause  */
+#line 135 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2437 "y.tab.c"
+    break;
+
+  case 14: /* clause: block_clause  */
+#line 136 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2443 "y.tab.c"
+    break;
+
+  case 15: /* clause: choose_clause  */
+#line 137 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2449 "y.tab.c"
+    break;
+
+  case 16: /* clause: collect_clause  */
+#line 138 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2455 "y.tab.c"
+    break;
+
+  case 17: /* clause: gather_clause  */
+#line 139 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2461 "y.tab.c"
+    break;
+
+  case 18: /* clause: define_clause  */
+#line 140 "parser.y"
+                                { (yyval.val) = list(define_transform((yyvsp[0].val)), nao);
+                                  rlcp(car((yyval.val)), (yyvsp[0].val));
+                                  rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2469 "y.tab.c"
+    break;
+
+  case 19: /* clause: try_clause  */
+#line 143 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2475 "y.tab.c"
+    break;
+
+  case 20: /* clause: output_clause  */
+#line 144 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2481 "y.tab.c"
+    break;
+
+  case 21: /* clause: line  */
+#line 145 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 2487 "y.tab.c"
+    break;
+
+  case 22: /* clause: repeat_clause  */
+#line 146 "parser.y"
+                                { (yyval.val) = nil;
+                                  yyerror("repeat outside of output"); }
+#line 2494 "y.tab.c"
+    break;
+
+  case 23: /* all_clause: ALL newl clause_parts  */
+#line 150 "parser.y"
+                                        { (yyval.val) = list(all_s, (yyvsp[0].val), nao);
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 2501 "y.tab.c"
+    break;
+
+  case 24: /* all_clause: ALL newl error  */
+#line 152 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("all clause")); }
+#line 2509 "y.tab.c"
+    break;
+
+  case 25: /* all_clause: ALL newl END newl  */
+#line 155 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("empty all clause"); }
+#line 2516 "y.tab.c"
+    break;
+
+  case 26: /* some_clause: SOME exprs_opt ')' newl clause_parts  */
+#line 161 "parser.y"
+                                        { (yyval.val) = list(some_s, (yyvsp[0].val), (yyvsp[-3].val), nao);
+                                          rl((yyval.val), num((yyvsp[-4].lineno))); }
+#line 2523 "y.tab.c"
+    break;
+
+  case 27: /* some_clause: SOME exprs_opt ')' newl error  */
+#line 165 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("some clause")); }
+#line 2531 "y.tab.c"
+    break;
+
+  case 28: /* some_clause: SOME exprs_opt ')' newl END newl  */
+#line 169 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("empty some clause"); }
+#line 2538 "y.tab.c"
+    break;
+
+  case 29: /* none_clause: NONE newl clause_parts  */
+#line 173 "parser.y"
+                                        { (yyval.val) = list(none_s, (yyvsp[0].val), nao);
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 2545 "y.tab.c"
+    break;
+
+  case 30: /* none_clause: NONE newl error  */
+#line 175 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("none clause")); }
+#line 2553 "y.tab.c"
+    break;
+
+  case 31: /* none_clause: NONE newl END newl  */
+#line 178 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("empty none clause"); }
+#line 2560 "y.tab.c"
+    break;
+
+  case 32: /* maybe_clause: MAYBE newl clause_parts  */
+#line 182 "parser.y"
+                                        { (yyval.val) = list(maybe_s, (yyvsp[0].val), nao);
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 2567 "y.tab.c"
+    break;
+
+  case 33: /* maybe_clause: MAYBE newl error  */
+#line 184 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("maybe clause")); }
+#line 2575 "y.tab.c"
+    break;
+
+  case 34: /* maybe_clause: MAYBE newl END newl  */
+#line 187 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("empty maybe clause"); }
+#line 2582 "y.tab.c"
+    break;
+
+  case 35: /* cases_clause: CASES newl clause_parts  */
+#line 191 "parser.y"
+                                        { (yyval.val) = list(cases_s, (yyvsp[0].val), nao);
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 2589 "y.tab.c"
+    break;
+
+  case 36: /* cases_clause: CASES newl error  */
+#line 193 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("cases clause")); }
+#line 2597 "y.tab.c"
+    break;
+
+  case 37: /* cases_clause: CASES newl END newl  */
+#line 196 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("empty cases clause"); }
+#line 2604 "y.tab.c"
+    break;
+
+  case 38: /* block_clause: BLOCK exprs_opt ')' newl clauses_opt END newl  */
+#line 202 "parser.y"
+                                        { val name = first((yyvsp[-5].val)); 
+                                          if (gt(length((yyvsp[-5].val)), one))
+                                            yyerror("block: takes zero or no arguments");
+                                          if (name && !bindable(name))
+                                            yyerrorf(lit("block: ~s is not a bindable symbol"),
+                                                     name, nao);
+                                          (yyval.val) = list(block_s, name, (yyvsp[-2].val), nao);
+                                          rl((yyval.val), num((yyvsp[-6].lineno))); }
+#line 2617 "y.tab.c"
+    break;
+
+  case 39: /* block_clause: BLOCK exprs_opt ')' newl error  */
+#line 211 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("block clause")); }
+#line 2625 "y.tab.c"
+    break;
+
+  case 40: /* choose_clause: CHOOSE exprs_opt ')' newl clause_parts  */
+#line 217 "parser.y"
+                                        { (yyval.val) = list(choose_s, (yyvsp[0].val), (yyvsp[-3].val), nao);
+                                          rl((yyval.val), num((yyvsp[-4].lineno))); }
+#line 2632 "y.tab.c"
+    break;
+
+  case 41: /* choose_clause: CHOOSE exprs_opt ')' newl error  */
+#line 220 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("choose clause")); }
+#line 2640 "y.tab.c"
+    break;
+
+  case 42: /* choose_clause: CHOOSE exprs_opt ')' newl END newl  */
+#line 224 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("empty choose clause"); }
+#line 2647 "y.tab.c"
+    break;
+
+  case 43: /* gather_clause: GATHER exprs_opt ')' newl gather_parts END newl  */
+#line 230 "parser.y"
+                                        { (yyval.val) = list(gather_s, 
+                                                    append2(mapcar(curry_12_1(func_n2(cons), nil),
+                                                                   first((yyvsp[-2].val))), rest((yyvsp[-2].val))),
+                                                    (yyvsp[-5].val), nao); 
+                                          rl((yyval.val), num((yyvsp[-6].lineno))); }
+#line 2657 "y.tab.c"
+    break;
+
+  case 44: /* gather_clause: GATHER exprs_opt ')' newl gather_parts until_last newl clauses END newl  */
+#line 240 "parser.y"
+                                        { (yyval.val) = list(gather_s, 
+                                                    append2(mapcar(curry_12_1(func_n2(cons), nil),
+                                                                   first((yyvsp[-5].val))), rest((yyvsp[-5].val))),
+                                                    (yyvsp[-8].val), cons(cdr((yyvsp[-4].val)), (yyvsp[-2].val)), nao); 
+                                          rl((yyval.val), num((yyvsp[-9].lineno))); }
+#line 2667 "y.tab.c"
+    break;
+
+  case 45: /* gather_clause: GATHER exprs_opt ')' newl error  */
+#line 247 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("gather clause")); }
+#line 2675 "y.tab.c"
+    break;
+
+  case 46: /* gather_clause: GATHER exprs_opt ')' newl END newl  */
+#line 251 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("empty gather clause"); }
+#line 2682 "y.tab.c"
+    break;
+
+  case 47: /* gather_parts: clauses additional_gather_parts  */
+#line 255 "parser.y"
+                                                { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2688 "y.tab.c"
+    break;
+
+  case 48: /* additional_gather_parts: AND newl clauses additional_gather_parts  */
+#line 258 "parser.y"
+                                                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2694 "y.tab.c"
+    break;
+
+  case 49: /* additional_gather_parts: OR newl clauses additional_parts  */
+#line 259 "parser.y"
+                                                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2700 "y.tab.c"
+    break;
+
+  case 50: /* additional_gather_parts: %empty  */
+#line 260 "parser.y"
+                                                                        { (yyval.val) = nil; }
+#line 2706 "y.tab.c"
+    break;
+
+  case 51: /* collect_clause: COLLECT exprs_opt ')' newl clauses END newl  */
+#line 264 "parser.y"
+                                                 { (yyval.val) = list(collect_s,
+                                                             (yyvsp[-2].val), nil, (yyvsp[-5].val),
+                                                             nao);
+                                                   rl((yyval.val), num((yyvsp[-6].lineno))); }
+#line 2715 "y.tab.c"
+    break;
+
+  case 52: /* collect_clause: COLLECT exprs_opt ')' newl clauses until_last newl clauses END newl  */
+#line 270 "parser.y"
+                                          { (yyval.val) = list(collect_s, (yyvsp[-5].val),
+                                                      cons(cdr((yyvsp[-4].val)), (yyvsp[-2].val)),
+                                                      (yyvsp[-8].val), nao);
+                                            rl((yyval.val), num((yyvsp[-9].lineno))); 
+                                            rl((yyvsp[-2].val), car((yyvsp[-4].val))); }
+#line 2725 "y.tab.c"
+    break;
+
+  case 53: /* collect_clause: COLLECT exprs_opt ')' newl error  */
+#line 276 "parser.y"
+                                        { (yyval.val) = nil;
+                                          if (yychar == UNTIL ||
+                                              yychar == END ||
+                                              yychar == LAST)
+                                            yyerror("empty collect");
+                                          else
+                                            yybadtoken(yychar,
+                                                       lit("collect clause")); }
+#line 2738 "y.tab.c"
+    break;
+
+  case 54: /* until_last: UNTIL  */
+#line 286 "parser.y"
+                   { (yyval.val) = cons(num((yyvsp[0].lineno)), until_s); }
+#line 2744 "y.tab.c"
+    break;
+
+  case 55: /* until_last: LAST  */
+#line 287 "parser.y"
+                   { (yyval.val) = cons(num((yyvsp[0].lineno)), last_s); }
+#line 2750 "y.tab.c"
+    break;
+
+  case 56: /* clause_parts: clauses additional_parts  */
+#line 290 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2756 "y.tab.c"
+    break;
+
+  case 57: /* additional_parts: END newl  */
+#line 293 "parser.y"
+                                                        { (yyval.val) = nil; }
+#line 2762 "y.tab.c"
+    break;
+
+  case 58: /* additional_parts: AND newl clauses additional_parts  */
+#line 294 "parser.y"
+                                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2768 "y.tab.c"
+    break;
+
+  case 59: /* additional_parts: OR newl clauses additional_parts  */
+#line 295 "parser.y"
+                                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2774 "y.tab.c"
+    break;
+
+  case 60: /* line: elems_opt '\n'  */
+#line 298 "parser.y"
+                                { (yyval.val) = (yyvsp[-1].val); }
+#line 2780 "y.tab.c"
+    break;
+
+  case 61: /* elems_opt: elems  */
+#line 301 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 2786 "y.tab.c"
+    break;
+
+  case 62: /* elems_opt: %empty  */
+#line 302 "parser.y"
+                                { (yyval.val) = nil; }
+#line 2792 "y.tab.c"
+    break;
+
+  case 63: /* elems: elem  */
+#line 305 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); 
+                                  rlcp((yyval.val), (yyvsp[0].val)); }
+#line 2799 "y.tab.c"
+    break;
+
+  case 64: /* elems: elem elems  */
+#line 307 "parser.y"
+                                { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val));
+                                  rlcp((yyval.val), (yyvsp[-1].val)); }
+#line 2806 "y.tab.c"
+    break;
+
+  case 65: /* elems: rep_elem  */
+#line 309 "parser.y"
+                                { (yyval.val) = nil;
+                                  yyerror("rep outside of output"); }
+#line 2813 "y.tab.c"
+    break;
+
+  case 66: /* text: TEXT  */
+#line 314 "parser.y"
+                                { (yyval.val) = rl(string_own((yyvsp[0].lexeme)), num(lineno)); }
+#line 2819 "y.tab.c"
+    break;
+
+  case 67: /* text: SPACE  */
+#line 315 "parser.y"
+                                { if ((yyvsp[0].lexeme)[0] == ' ' && (yyvsp[0].lexeme)[1] == 0)
+                                  { val spaces = list(oneplus_s, 
+                                                      chr(' '), nao);
+                                    (yyval.val) = cons(regex_compile(spaces), spaces);
+                                    rl((yyval.val), num(lineno));
+                                    free((yyvsp[0].lexeme)); }
+                                  else
+                                  { (yyval.val) = rl(string_own((yyvsp[0].lexeme)), num(lineno)); }}
+#line 2832 "y.tab.c"
+    break;
+
+  case 68: /* text: regex  */
+#line 323 "parser.y"
+                                { (yyval.val) = cons(regex_compile(rest((yyvsp[0].val))),
+                                            rest((yyvsp[0].val)));
+                                  rl((yyval.val), num(lineno)); }
+#line 2840 "y.tab.c"
+    break;
+
+  case 69: /* texts: text  */
+#line 328 "parser.y"
+                                { (yyval.val) = rlcp(cons((yyvsp[0].val), nil), (yyvsp[0].val)); }
+#line 2846 "y.tab.c"
+    break;
+
+  case 70: /* texts: text texts  */
+#line 329 "parser.y"
+                                { (yyval.val) = rlcp(cons((yyvsp[-1].val), (yyvsp[0].val)), (yyvsp[0].val)); }
+#line 2852 "y.tab.c"
+    break;
+
+  case 71: /* elem: texts  */
+#line 332 "parser.y"
+                                { (yyval.val) = rlcp(cons(text_s, (yyvsp[0].val)), (yyvsp[0].val));
+                                  (yyval.val) = rlcp(optimize_text((yyval.val)), (yyval.val)); }
+#line 2859 "y.tab.c"
+    break;
+
+  case 72: /* elem: var  */
+#line 334 "parser.y"
+                                { (yyval.val) = rl((yyvsp[0].val), num(lineno)); }
+#line 2865 "y.tab.c"
+    break;
+
+  case 73: /* elem: list  */
+#line 335 "parser.y"
+                                { if (first((yyvsp[0].val)) == do_s)
+                                    (yyval.val) = expand((yyvsp[0].val));
+                                  else
+                                    (yyval.val) = (yyvsp[0].val); }
+#line 2874 "y.tab.c"
+    break;
+
+  case 74: /* elem: COLL exprs_opt ')' elems END  */
+#line 339 "parser.y"
+                                        { (yyval.val) = list(coll_s, (yyvsp[-1].val), nil, (yyvsp[-3].val), nao);
+                                          rl((yyval.val), num((yyvsp[-4].lineno))); }
+#line 2881 "y.tab.c"
+    break;
+
+  case 75: /* elem: COLL exprs_opt ')' elems until_last elems END  */
+#line 342 "parser.y"
+                                { (yyval.val) = list(coll_s, (yyvsp[-3].val), cons(cdr((yyvsp[-2].val)), (yyvsp[-1].val)), 
+                                            (yyvsp[-5].val), nao);
+                                  rl((yyval.val), num((yyvsp[-6].lineno)));
+                                  rl((yyvsp[-1].val), car((yyvsp[-2].val))); }
+#line 2890 "y.tab.c"
+    break;
+
+  case 76: /* elem: COLL error  */
+#line 346 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("coll clause")); }
+#line 2897 "y.tab.c"
+    break;
+
+  case 77: /* elem: ALL clause_parts_h  */
+#line 348 "parser.y"
+                                { (yyval.val) = rl(list(all_s, t, (yyvsp[0].val), nao), num((yyvsp[-1].lineno))); }
+#line 2903 "y.tab.c"
+    break;
+
+  case 78: /* elem: ALL END  */
+#line 349 "parser.y"
+                                { yyerror("empty all clause"); }
+#line 2909 "y.tab.c"
+    break;
+
+  case 79: /* elem: SOME exprs_opt ')' clause_parts_h  */
+#line 351 "parser.y"
+                                { (yyval.val) = rl(list(some_s, t, (yyvsp[0].val), (yyvsp[-2].val), nao), num((yyvsp[-3].lineno))); }
+#line 2915 "y.tab.c"
+    break;
+
+  case 80: /* elem: SOME exprs_opt ')' END  */
+#line 352 "parser.y"
+                                { yyerror("empty some clause"); }
+#line 2921 "y.tab.c"
+    break;
+
+  case 81: /* elem: NONE clause_parts_h  */
+#line 353 "parser.y"
+                                { (yyval.val) = rl(list(none_s, t, (yyvsp[0].val), nao), num((yyvsp[-1].lineno))); }
+#line 2927 "y.tab.c"
+    break;
+
+  case 82: /* elem: NONE END  */
+#line 354 "parser.y"
+                                { yyerror("empty none clause"); }
+#line 2933 "y.tab.c"
+    break;
+
+  case 83: /* elem: MAYBE clause_parts_h  */
+#line 355 "parser.y"
+                                { (yyval.val) = rl(list(maybe_s, t, (yyvsp[0].val), nao), num((yyvsp[-1].lineno))); }
+#line 2939 "y.tab.c"
+    break;
+
+  case 84: /* elem: MAYBE END  */
+#line 356 "parser.y"
+                                { yyerror("empty maybe clause"); }
+#line 2945 "y.tab.c"
+    break;
+
+  case 85: /* elem: CASES clause_parts_h  */
+#line 357 "parser.y"
+                                { (yyval.val) = rl(list(cases_s, t, (yyvsp[0].val), nao), num((yyvsp[-1].lineno))); }
+#line 2951 "y.tab.c"
+    break;
+
+  case 86: /* elem: CASES END  */
+#line 358 "parser.y"
+                                { yyerror("empty cases clause"); }
+#line 2957 "y.tab.c"
+    break;
+
+  case 87: /* elem: CHOOSE exprs_opt ')' clause_parts_h  */
+#line 360 "parser.y"
+                                { (yyval.val) = list(choose_s, t, (yyvsp[0].val), (yyvsp[-2].val), nao);
+                                  rl((yyval.val), num((yyvsp[-3].lineno))); }
+#line 2964 "y.tab.c"
+    break;
+
+  case 88: /* elem: CHOOSE exprs_opt ')' END  */
+#line 362 "parser.y"
+                                { yyerror("empty cases clause"); }
+#line 2970 "y.tab.c"
+    break;
+
+  case 89: /* elem: DEFINE exprs ')' elems END  */
+#line 363 "parser.y"
+                                        { (yyval.val) = list(define_s, t, (yyvsp[-1].val), (yyvsp[-3].val), nao);
+                                          rl((yyval.val), num((yyvsp[-4].lineno))); }
+#line 2977 "y.tab.c"
+    break;
+
+  case 90: /* clause_parts_h: elems additional_parts_h  */
+#line 367 "parser.y"
+                                          { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2983 "y.tab.c"
+    break;
+
+  case 91: /* additional_parts_h: END  */
+#line 370 "parser.y"
+                                                        { (yyval.val) = nil; }
+#line 2989 "y.tab.c"
+    break;
+
+  case 92: /* additional_parts_h: AND elems additional_parts_h  */
+#line 371 "parser.y"
+                                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 2995 "y.tab.c"
+    break;
+
+  case 93: /* additional_parts_h: OR elems additional_parts_h  */
+#line 372 "parser.y"
+                                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 3001 "y.tab.c"
+    break;
+
+  case 94: /* define_clause: DEFINE exprs ')' newl clauses_opt END newl  */
+#line 377 "parser.y"
+                                { (yyval.val) = list(define_s, (yyvsp[-5].val), (yyvsp[-2].val), nao);
+                                  rl((yyval.val), num((yyvsp[-6].lineno))); }
+#line 3008 "y.tab.c"
+    break;
+
+  case 95: /* define_clause: DEFINE ')' newl clauses_opt END newl  */
+#line 381 "parser.y"
+                                { (yyval.val) = list(define_s, nil, (yyvsp[-2].val), nao);
+                                  rl((yyval.val), num((yyvsp[-5].lineno))); }
+#line 3015 "y.tab.c"
+    break;
+
+  case 96: /* define_clause: DEFINE error  */
+#line 383 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("list expression")); }
+#line 3022 "y.tab.c"
+    break;
+
+  case 97: /* define_clause: DEFINE exprs ')' newl error  */
+#line 386 "parser.y"
+                                { (yyval.val) = nil; yybadtoken(yychar, lit("define")); }
+#line 3028 "y.tab.c"
+    break;
+
+  case 98: /* define_clause: DEFINE ')' newl error  */
+#line 388 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("define")); }
+#line 3035 "y.tab.c"
+    break;
+
+  case 99: /* try_clause: TRY newl clauses catch_clauses_opt END newl  */
+#line 395 "parser.y"
+                                { (yyval.val) = list(try_s,
+                                            flatten(mapcar(func_n1(second),
+                                                           (yyvsp[-2].val))),
+                                            (yyvsp[-3].val), (yyvsp[-2].val), nao);
+                                  rl((yyval.val), num((yyvsp[-5].lineno))); }
+#line 3045 "y.tab.c"
+    break;
+
+  case 100: /* try_clause: TRY newl error  */
+#line 401 "parser.y"
+                                { (yyval.val) = nil;
+                                  if (yychar == END || yychar == CATCH ||
+                                      yychar == FINALLY)
+                                    yyerror("empty try clause");
+                                  else
+                                    yybadtoken(yychar, lit("try clause")); }
+#line 3056 "y.tab.c"
+    break;
+
+  case 101: /* try_clause: TRY newl clauses error  */
+#line 409 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("try clause")); }
+#line 3063 "y.tab.c"
+    break;
+
+  case 102: /* catch_clauses_opt: CATCH ')' newl clauses_opt catch_clauses_opt  */
+#line 415 "parser.y"
+                                        { (yyval.val) = cons(list(catch_s, cons(t, nil),
+                                                         (yyvsp[-1].val), nao), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-4].lineno))); }
+#line 3071 "y.tab.c"
+    break;
+
+  case 103: /* catch_clauses_opt: CATCH exprs ')' newl clauses_opt catch_clauses_opt  */
+#line 420 "parser.y"
+                                        { (yyval.val) = cons(list(catch_s, (yyvsp[-4].val), (yyvsp[-1].val), nao),
+                                                    (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-5].lineno))); }
+#line 3079 "y.tab.c"
+    break;
+
+  case 104: /* catch_clauses_opt: FINALLY newl clauses_opt  */
+#line 424 "parser.y"
+                                        { (yyval.val) = cons(list(finally_s, nil,
+                                                         (yyvsp[0].val), nao),
+                                                    nil);
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 3088 "y.tab.c"
+    break;
+
+  case 105: /* catch_clauses_opt: %empty  */
+#line 428 "parser.y"
+                                        { (yyval.val) = nil; }
+#line 3094 "y.tab.c"
+    break;
+
+  case 106: /* catch_clauses_opt: CATCH ')' newl error  */
+#line 430 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("try clause")); }
+#line 3102 "y.tab.c"
+    break;
+
+  case 107: /* catch_clauses_opt: CATCH exprs ')' newl error  */
+#line 434 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("try clause")); }
+#line 3110 "y.tab.c"
+    break;
+
+  case 108: /* catch_clauses_opt: FINALLY newl error  */
+#line 438 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yybadtoken(yychar,
+                                                     lit("try clause")); }
+#line 3118 "y.tab.c"
+    break;
+
+  case 109: /* output_clause: OUTPUT ')' o_elems '\n' out_clauses END newl  */
+#line 446 "parser.y"
+                                { (yyval.val) = nil;
+                                  yyerror("obsolete output syntax: trailing material"); }
+#line 3125 "y.tab.c"
+    break;
+
+  case 110: /* output_clause: OUTPUT ')' newl END newl  */
+#line 449 "parser.y"
+                                { (yyval.val) = rl(list(output_s, nao), num((yyvsp[-4].lineno))); }
+#line 3131 "y.tab.c"
+    break;
+
+  case 111: /* output_clause: OUTPUT ')' newl out_clauses END newl  */
+#line 452 "parser.y"
+                                { (yyval.val) = rl(list(output_s, (yyvsp[-2].val), nao), num((yyvsp[-5].lineno))); }
+#line 3137 "y.tab.c"
+    break;
+
+  case 112: /* output_clause: OUTPUT exprs ')' newl out_clauses END newl  */
+#line 455 "parser.y"
+                                { (yyval.val) = list(output_s, (yyvsp[-2].val), (yyvsp[-5].val), nao);
+                                  rl((yyval.val), num((yyvsp[-6].lineno))); }
+#line 3144 "y.tab.c"
+    break;
+
+  case 113: /* output_clause: OUTPUT exprs ')' o_elems '\n' out_clauses END newl  */
+#line 460 "parser.y"
+                                { (yyval.val) = nil;
+                                  yyerror("invalid combination of old and "
+                                          "new syntax in output directive"); }
+#line 3152 "y.tab.c"
+    break;
+
+  case 114: /* output_clause: OUTPUT error  */
+#line 463 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("list expression")); }
+#line 3159 "y.tab.c"
+    break;
+
+  case 115: /* output_clause: OUTPUT ')' o_elems '\n' error  */
+#line 466 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("output clause")); }
+#line 3166 "y.tab.c"
+    break;
+
+  case 116: /* output_clause: OUTPUT ')' newl error  */
+#line 469 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("output clause")); }
+#line 3173 "y.tab.c"
+    break;
+
+  case 117: /* output_clause: OUTPUT exprs ')' o_elems '\n' error  */
+#line 472 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("output clause")); }
+#line 3180 "y.tab.c"
+    break;
+
+  case 118: /* output_clause: OUTPUT exprs ')' newl error  */
+#line 475 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("output clause")); }
+#line 3187 "y.tab.c"
+    break;
+
+  case 119: /* out_clauses: out_clause  */
+#line 479 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 3193 "y.tab.c"
+    break;
+
+  case 120: /* out_clauses: out_clause out_clauses  */
+#line 480 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val));  }
+#line 3199 "y.tab.c"
+    break;
+
+  case 121: /* out_clause: repeat_clause  */
+#line 483 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 3205 "y.tab.c"
+    break;
+
+  case 122: /* out_clause: o_line  */
+#line 484 "parser.y"
+                                        { (yyval.val) = (yyvsp[0].val); }
+#line 3211 "y.tab.c"
+    break;
+
+  case 123: /* out_clause: all_clause  */
+#line 485 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3218 "y.tab.c"
+    break;
+
+  case 124: /* out_clause: some_clause  */
+#line 487 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3225 "y.tab.c"
+    break;
+
+  case 125: /* out_clause: none_clause  */
+#line 489 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3232 "y.tab.c"
+    break;
+
+  case 126: /* out_clause: maybe_clause  */
+#line 491 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3239 "y.tab.c"
+    break;
+
+  case 127: /* out_clause: cases_clause  */
+#line 493 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3246 "y.tab.c"
+    break;
+
+  case 128: /* out_clause: choose_clause  */
+#line 495 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("choose clause in output"); }
+#line 3253 "y.tab.c"
+    break;
+
+  case 129: /* out_clause: collect_clause  */
+#line 497 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3260 "y.tab.c"
+    break;
+
+  case 130: /* out_clause: define_clause  */
+#line 499 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3267 "y.tab.c"
+    break;
+
+  case 131: /* out_clause: try_clause  */
+#line 502 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3274 "y.tab.c"
+    break;
+
+  case 132: /* out_clause: output_clause  */
+#line 504 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("match clause in output"); }
+#line 3281 "y.tab.c"
+    break;
+
+  case 133: /* repeat_clause: REPEAT exprs_opt ')' newl out_clauses_opt repeat_parts_opt END newl  */
+#line 511 "parser.y"
+                                        { (yyval.val) = repeat_rep_helper(repeat_s, 
+                                                                 (yyvsp[-6].val), (yyvsp[-3].val), (yyvsp[-2].val));
+                                          rl((yyval.val), num((yyvsp[-7].lineno))); }
+#line 3289 "y.tab.c"
+    break;
+
+  case 134: /* repeat_clause: REPEAT newl error  */
+#line 515 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("repeat clause")); }
+#line 3296 "y.tab.c"
+    break;
+
+  case 135: /* repeat_parts_opt: SINGLE newl out_clauses_opt repeat_parts_opt  */
+#line 521 "parser.y"
+                                        { (yyval.val) = cons(cons(single_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-3].lineno))); }
+#line 3303 "y.tab.c"
+    break;
+
+  case 136: /* repeat_parts_opt: FIRST newl out_clauses_opt repeat_parts_opt  */
+#line 525 "parser.y"
+                                        { (yyval.val) = cons(cons(first_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-3].lineno))); }
+#line 3310 "y.tab.c"
+    break;
+
+  case 137: /* repeat_parts_opt: LAST newl out_clauses_opt repeat_parts_opt  */
+#line 529 "parser.y"
+                                        { (yyval.val) = cons(cons(last_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-3].lineno))); }
+#line 3317 "y.tab.c"
+    break;
+
+  case 138: /* repeat_parts_opt: EMPTY newl out_clauses_opt repeat_parts_opt  */
+#line 533 "parser.y"
+                                        { (yyval.val) = cons(cons(empty_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-3].lineno))); }
+#line 3324 "y.tab.c"
+    break;
+
+  case 139: /* repeat_parts_opt: MOD exprs_opt ')' newl out_clauses_opt repeat_parts_opt  */
+#line 538 "parser.y"
+                                        { (yyval.val) = cons(cons(mod_s, 
+                                                         cons((yyvsp[-4].val), (yyvsp[-1].val))), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-5].lineno))); }
+#line 3332 "y.tab.c"
+    break;
+
+  case 140: /* repeat_parts_opt: MODLAST exprs_opt ')' newl out_clauses_opt repeat_parts_opt  */
+#line 544 "parser.y"
+                                        { (yyval.val) = cons(cons(modlast_s,
+                                                         cons((yyvsp[-4].val), (yyvsp[-1].val))), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-5].lineno))); }
+#line 3340 "y.tab.c"
+    break;
+
+  case 141: /* repeat_parts_opt: %empty  */
+#line 547 "parser.y"
+                                        { (yyval.val) = nil; }
+#line 3346 "y.tab.c"
+    break;
+
+  case 142: /* out_clauses_opt: out_clauses  */
+#line 551 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3352 "y.tab.c"
+    break;
+
+  case 143: /* out_clauses_opt: %empty  */
+#line 552 "parser.y"
+                                { (yyval.val) = nil; }
+#line 3358 "y.tab.c"
+    break;
+
+  case 144: /* o_line: o_elems_opt '\n'  */
+#line 554 "parser.y"
+                                { (yyval.val) = (yyvsp[-1].val); }
+#line 3364 "y.tab.c"
+    break;
+
+  case 145: /* o_elems_opt: o_elems  */
+#line 557 "parser.y"
+                                { (yyval.val) = o_elems_transform((yyvsp[0].val));
+                                  rl((yyval.val), num(lineno)); }
+#line 3371 "y.tab.c"
+    break;
+
+  case 146: /* o_elems_opt: %empty  */
+#line 559 "parser.y"
+                                { (yyval.val) = nil; }
+#line 3377 "y.tab.c"
+    break;
+
+  case 147: /* o_elems: o_elem  */
+#line 562 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 3383 "y.tab.c"
+    break;
+
+  case 148: /* o_elems: o_elem o_elems  */
+#line 563 "parser.y"
+                                { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 3389 "y.tab.c"
+    break;
+
+  case 149: /* o_elem: TEXT  */
+#line 566 "parser.y"
+                                { (yyval.val) = string_own((yyvsp[0].lexeme));
+                                  rl((yyval.val), num(lineno)); }
+#line 3396 "y.tab.c"
+    break;
+
+  case 150: /* o_elem: SPACE  */
+#line 568 "parser.y"
+                                { (yyval.val) = string_own((yyvsp[0].lexeme));
+                                  rl((yyval.val), num(lineno)); }
+#line 3403 "y.tab.c"
+    break;
+
+  case 151: /* o_elem: o_var  */
+#line 570 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3409 "y.tab.c"
+    break;
+
+  case 152: /* o_elem: list  */
+#line 571 "parser.y"
+                                { (yyval.val) = rlcp(cons(expr_s, expand((yyvsp[0].val))), (yyvsp[0].val)); }
+#line 3415 "y.tab.c"
+    break;
+
+  case 153: /* o_elem: rep_elem  */
+#line 572 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3421 "y.tab.c"
+    break;
+
+  case 154: /* rep_elem: REP exprs_opt ')' o_elems_opt rep_parts_opt END  */
+#line 576 "parser.y"
+                                { (yyval.val) = repeat_rep_helper(rep_s, 
+                                                         (yyvsp[-4].val),
+                                                         o_elems_transform((yyvsp[-2].val)),
+                                                         (yyvsp[-1].val));
+                                  rl((yyval.val), num((yyvsp[-5].lineno))); }
+#line 3431 "y.tab.c"
+    break;
+
+  case 155: /* rep_elem: REP error  */
+#line 581 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("rep clause")); }
+#line 3438 "y.tab.c"
+    break;
+
+  case 156: /* rep_parts_opt: SINGLE o_elems_opt rep_parts_opt  */
+#line 586 "parser.y"
+                                        { (yyval.val) = cons(cons(single_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 3445 "y.tab.c"
+    break;
+
+  case 157: /* rep_parts_opt: FIRST o_elems_opt rep_parts_opt  */
+#line 589 "parser.y"
+                                        { (yyval.val) = cons(cons(first_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 3452 "y.tab.c"
+    break;
+
+  case 158: /* rep_parts_opt: LAST o_elems_opt rep_parts_opt  */
+#line 592 "parser.y"
+                                        { (yyval.val) = cons(cons(last_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 3459 "y.tab.c"
+    break;
+
+  case 159: /* rep_parts_opt: EMPTY o_elems_opt rep_parts_opt  */
+#line 595 "parser.y"
+                                        { (yyval.val) = cons(cons(empty_s, (yyvsp[-1].val)), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-2].lineno))); }
+#line 3466 "y.tab.c"
+    break;
+
+  case 160: /* rep_parts_opt: MOD exprs_opt ')' o_elems_opt rep_parts_opt  */
+#line 599 "parser.y"
+                                        { (yyval.val) = cons(cons(mod_s, 
+                                                         cons((yyvsp[-3].val), (yyvsp[-1].val))), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-4].lineno))); }
+#line 3474 "y.tab.c"
+    break;
+
+  case 161: /* rep_parts_opt: MODLAST exprs_opt ')' o_elems_opt rep_parts_opt  */
+#line 604 "parser.y"
+                                        { (yyval.val) = cons(cons(modlast_s, 
+                                                         cons((yyvsp[-3].val), (yyvsp[-1].val))), (yyvsp[0].val));
+                                          rl((yyval.val), num((yyvsp[-4].lineno))); }
+#line 3482 "y.tab.c"
+    break;
+
+  case 162: /* rep_parts_opt: %empty  */
+#line 607 "parser.y"
+                                        { (yyval.val) = nil; }
+#line 3488 "y.tab.c"
+    break;
+
+  case 163: /* var: IDENT  */
+#line 614 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[0].lexeme)), nil),
+                                            nao); }
+#line 3495 "y.tab.c"
+    break;
+
+  case 164: /* var: IDENT elem  */
+#line 616 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-1].lexeme)), nil),
+                                            (yyvsp[0].val), nao); }
+#line 3502 "y.tab.c"
+    break;
+
+  case 165: /* var: '{' IDENT '}'  */
+#line 618 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-1].lexeme)), nil),
+                                            nao); }
+#line 3509 "y.tab.c"
+    break;
+
+  case 166: /* var: '{' IDENT '}' elem  */
+#line 620 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-2].lexeme)), nil),
+                                            (yyvsp[0].val), nao); }
+#line 3516 "y.tab.c"
+    break;
+
+  case 167: /* var: '{' IDENT modifiers '}'  */
+#line 622 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-2].lexeme)), nil),
+                                            nil, (yyvsp[-1].val), nao); }
+#line 3523 "y.tab.c"
+    break;
+
+  case 168: /* var: '{' IDENT modifiers '}' elem  */
+#line 625 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-3].lexeme)), nil),
+                                            (yyvsp[0].val), (yyvsp[-2].val), nao); }
+#line 3530 "y.tab.c"
+    break;
+
+  case 169: /* var: var_op IDENT  */
+#line 627 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[0].lexeme)), nil),
+                                            nil, (yyvsp[-1].val), nao); }
+#line 3537 "y.tab.c"
+    break;
+
+  case 170: /* var: var_op IDENT elem  */
+#line 629 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-1].lexeme)), nil),
+                                            (yyvsp[0].val), (yyvsp[-2].val), nao); }
+#line 3544 "y.tab.c"
+    break;
+
+  case 171: /* var: var_op '{' IDENT '}'  */
+#line 631 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-1].lexeme)), nil),
+                                            nil, (yyvsp[-3].val), nao); }
+#line 3551 "y.tab.c"
+    break;
+
+  case 172: /* var: var_op '{' IDENT '}' elem  */
+#line 633 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-2].lexeme)), nil),
+                                            (yyvsp[0].val), (yyvsp[-4].val), nao); }
+#line 3558 "y.tab.c"
+    break;
+
+  case 173: /* var: var_op '{' IDENT regex '}'  */
+#line 635 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("longest match "
+                                                  "not useable with regex"); }
+#line 3566 "y.tab.c"
+    break;
+
+  case 174: /* var: var_op '{' IDENT NUMBER '}'  */
+#line 638 "parser.y"
+                                        { (yyval.val) = nil;
+                                          yyerror("longest match "
+                                                  "not useable with "
+                                                  "fixed width match"); }
+#line 3575 "y.tab.c"
+    break;
+
+  case 175: /* var: IDENT error  */
+#line 642 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("variable spec")); }
+#line 3582 "y.tab.c"
+    break;
+
+  case 176: /* var: var_op error  */
+#line 644 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("variable spec")); }
+#line 3589 "y.tab.c"
+    break;
+
+  case 177: /* var_op: '*'  */
+#line 648 "parser.y"
+                                { (yyval.val) = list(t, nao); }
+#line 3595 "y.tab.c"
+    break;
+
+  case 178: /* modifiers: NUMBER  */
+#line 651 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 3601 "y.tab.c"
+    break;
+
+  case 179: /* modifiers: regex  */
+#line 652 "parser.y"
+                                { (yyval.val) = cons(cons(regex_compile(rest((yyvsp[0].val))), 
+                                                 rest((yyvsp[0].val))), nil);
+                                  rlcp((yyval.val), (yyvsp[0].val)); }
+#line 3609 "y.tab.c"
+    break;
+
+  case 180: /* modifiers: list  */
+#line 655 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 3615 "y.tab.c"
+    break;
+
+  case 181: /* o_var: IDENT  */
+#line 658 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[0].lexeme)), nil),
+                                            nao); }
+#line 3622 "y.tab.c"
+    break;
+
+  case 182: /* o_var: IDENT o_elem  */
+#line 660 "parser.y"
+                                { (yyval.val) = list(var_s, intern(string_own((yyvsp[-1].lexeme)), nil),
+                                            (yyvsp[0].val), nao); }
+#line 3629 "y.tab.c"
+    break;
+
+  case 183: /* o_var: '{' expr exprs_opt '}'  */
+#line 663 "parser.y"
+                                { (yyval.val) = list(var_s, (yyvsp[-2].val), nil, (yyvsp[-1].val), nao); }
+#line 3635 "y.tab.c"
+    break;
+
+  case 184: /* o_var: '{' expr exprs_opt '}' o_elem  */
+#line 665 "parser.y"
+                                { (yyval.val) = list(var_s, (yyvsp[-3].val), (yyvsp[0].val), (yyvsp[-2].val), nao); }
+#line 3641 "y.tab.c"
+    break;
+
+  case 185: /* o_var: IDENT error  */
+#line 666 "parser.y"
+                                { (yyval.val) = nil;
+                                    yybadtoken(yychar, lit("variable spec")); }
+#line 3648 "y.tab.c"
+    break;
+
+  case 186: /* vector: '#' list  */
+#line 670 "parser.y"
+                                { if (unquotes_occur((yyvsp[0].val)))
+                                    (yyval.val) = rlcp(cons(vector_lit_s,
+                                                   cons((yyvsp[0].val), nil)), (yyvsp[0].val));
+                                  else
+                                    (yyval.val) = rlcp(vector_list((yyvsp[0].val)), (yyvsp[0].val)); }
+#line 3658 "y.tab.c"
+    break;
+
+  case 187: /* hash: HASH_H list  */
+#line 677 "parser.y"
+                                { if (unquotes_occur((yyvsp[0].val)))
+                                    (yyval.val) = rlcp(cons(hash_lit_s, (yyvsp[0].val)),
+                                              num((yyvsp[-1].lineno)));
+                                  else
+                                    (yyval.val) = rlcp(hash_construct(first((yyvsp[0].val)),
+                                                             rest((yyvsp[0].val))),
+                                              num((yyvsp[-1].lineno))); }
+#line 3670 "y.tab.c"
+    break;
+
+  case 188: /* list: '(' exprs ')'  */
+#line 686 "parser.y"
+                                { (yyval.val) = rl((yyvsp[-1].val), num((yyvsp[-2].lineno))); }
+#line 3676 "y.tab.c"
+    break;
+
+  case 189: /* list: '(' ')'  */
+#line 687 "parser.y"
+                                { (yyval.val) = nil; }
+#line 3682 "y.tab.c"
+    break;
+
+  case 190: /* list: '[' exprs ']'  */
+#line 688 "parser.y"
+                                { (yyval.val) = rl(cons(dwim_s, (yyvsp[-1].val)), num((yyvsp[-2].lineno))); }
+#line 3688 "y.tab.c"
+    break;
+
+  case 191: /* list: '[' ']'  */
+#line 689 "parser.y"
+                                { (yyval.val) = rl(cons(dwim_s, nil), num((yyvsp[-1].lineno))); }
+#line 3694 "y.tab.c"
+    break;
+
+  case 192: /* list: ',' expr  */
+#line 690 "parser.y"
+                                { val expr = (yyvsp[0].val);
+                                  if (consp(expr) && first(expr) == qquote_s)
+                                    expr = cons(quote_s, rest(expr));
+                                  (yyval.val) = rlcp(list(unquote_s, expr, nao), (yyvsp[0].val)); }
+#line 3703 "y.tab.c"
+    break;
+
+  case 193: /* list: '\'' expr  */
+#line 694 "parser.y"
+                                { (yyval.val) = rlcp(list(choose_quote((yyvsp[0].val)),
+                                            (yyvsp[0].val), nao), (yyvsp[0].val)); }
+#line 3710 "y.tab.c"
+    break;
+
+  case 194: /* list: SPLICE expr  */
+#line 696 "parser.y"
+                                { val expr = (yyvsp[0].val);
+                                  if (consp(expr) && first(expr) == qquote_s)
+                                    expr = cons(quote_s, rest(expr));
+                                  (yyval.val) = rlcp(list(splice_s, expr, nao), (yyvsp[0].val)); }
+#line 3719 "y.tab.c"
+    break;
+
+  case 195: /* list: '(' error  */
+#line 700 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("list expression")); }
+#line 3726 "y.tab.c"
+    break;
+
+  case 196: /* list: '[' error  */
+#line 702 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("DWIM expression")); }
+#line 3733 "y.tab.c"
+    break;
+
+  case 197: /* meta_expr: METAPAR exprs ')'  */
+#line 706 "parser.y"
+                                { (yyval.val) = rlcp(cons(expr_s, expand((yyvsp[-1].val))), (yyvsp[-1].val)); }
+#line 3739 "y.tab.c"
+    break;
+
+  case 198: /* meta_expr: METABKT exprs ']'  */
+#line 707 "parser.y"
+                                { (yyval.val) = rlcp(cons(expr_s, 
+                                                 rlcp(expand(cons(dwim_s, (yyvsp[-1].val))),
+                                                      (yyvsp[-1].val))), 
+                                            (yyvsp[-1].val)); }
+#line 3748 "y.tab.c"
+    break;
+
+  case 199: /* meta_expr: METAPAR ')'  */
+#line 711 "parser.y"
+                                { (yyval.val) = rl(cons(expr_s, nil), num(lineno)); }
+#line 3754 "y.tab.c"
+    break;
+
+  case 200: /* meta_expr: METABKT ']'  */
+#line 712 "parser.y"
+                                { (yyval.val) = rl(cons(expr_s, rl(cons(dwim_s, nil), 
+                                                          num(lineno))),
+                                          num(lineno)); }
+#line 3762 "y.tab.c"
+    break;
+
+  case 201: /* meta_expr: METAPAR error  */
+#line 715 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("meta expression")); }
+#line 3769 "y.tab.c"
+    break;
+
+  case 202: /* exprs: expr  */
+#line 718 "parser.y"
+                                { (yyval.val) = rlcp(cons((yyvsp[0].val), nil), (yyvsp[0].val)); }
+#line 3775 "y.tab.c"
+    break;
+
+  case 203: /* exprs: expr exprs  */
+#line 719 "parser.y"
+                                { (yyval.val) = rlcp(cons((yyvsp[-1].val), (yyvsp[0].val)), (yyvsp[-1].val)); }
+#line 3781 "y.tab.c"
+    break;
+
+  case 204: /* exprs: expr '.' expr  */
+#line 720 "parser.y"
+                                { (yyval.val) = rlcp(cons((yyvsp[-2].val), (yyvsp[0].val)), (yyvsp[-2].val)); }
+#line 3787 "y.tab.c"
+    break;
+
+  case 205: /* exprs_opt: exprs  */
+#line 723 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3793 "y.tab.c"
+    break;
+
+  case 206: /* exprs_opt: %empty  */
+#line 724 "parser.y"
+                                { (yyval.val) = nil; }
+#line 3799 "y.tab.c"
+    break;
+
+  case 207: /* expr: IDENT  */
+#line 727 "parser.y"
+                                { (yyval.val) = rl(intern(string_own((yyvsp[0].lexeme)), nil), 
+                                          num(lineno)); }
+#line 3806 "y.tab.c"
+    break;
+
+  case 208: /* expr: KEYWORD  */
+#line 729 "parser.y"
+                                { (yyval.val) = rl(intern(string_own((yyvsp[0].lexeme)),
+                                                 keyword_package),
+                                          num(lineno)); }
+#line 3814 "y.tab.c"
+    break;
+
+  case 209: /* expr: METAVAR  */
+#line 732 "parser.y"
+                                { (yyval.val) = list(var_s,
+                                            intern(string_own((yyvsp[0].lexeme)), nil), nao);
+                                  rl((yyval.val), num(lineno)); }
+#line 3822 "y.tab.c"
+    break;
+
+  case 210: /* expr: METANUM  */
+#line 735 "parser.y"
+                                { (yyval.val) = cons(var_s, cons((yyvsp[0].val), nil));
+                                  rl((yyval.val), num(lineno)); }
+#line 3829 "y.tab.c"
+    break;
+
+  case 211: /* expr: NUMBER  */
+#line 737 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3835 "y.tab.c"
+    break;
+
+  case 212: /* expr: list  */
+#line 738 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3841 "y.tab.c"
+    break;
+
+  case 213: /* expr: vector  */
+#line 739 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3847 "y.tab.c"
+    break;
+
+  case 214: /* expr: hash  */
+#line 740 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3853 "y.tab.c"
+    break;
+
+  case 215: /* expr: meta_expr  */
+#line 741 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3859 "y.tab.c"
+    break;
+
+  case 216: /* expr: lisp_regex  */
+#line 742 "parser.y"
+                                { (yyval.val) = cons(regex_compile(rest((yyvsp[0].val))),
+                                            rest((yyvsp[0].val)));
+                                  rlcp((yyval.val), (yyvsp[0].val)); }
+#line 3867 "y.tab.c"
+    break;
+
+  case 217: /* expr: chrlit  */
+#line 745 "parser.y"
+                                { (yyval.val) = rl((yyvsp[0].val), num(lineno)); }
+#line 3873 "y.tab.c"
+    break;
+
+  case 218: /* expr: strlit  */
+#line 746 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3879 "y.tab.c"
+    break;
+
+  case 219: /* expr: quasilit  */
+#line 747 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 3885 "y.tab.c"
+    break;
+
+  case 220: /* expr: expr DOTDOT expr  */
+#line 748 "parser.y"
+                                { (yyval.val) = list(cons_s, (yyvsp[-2].val), (yyvsp[0].val), nao); }
+#line 3891 "y.tab.c"
+    break;
+
+  case 221: /* regex: '/' regexpr '/'  */
+#line 751 "parser.y"
+                                { (yyval.val) = cons(regex_s, (yyvsp[-1].val)); end_of_regex();
+                                  rl((yyval.val), num(lineno)); }
+#line 3898 "y.tab.c"
+    break;
+
+  case 222: /* regex: '/' error  */
+#line 753 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("regex"));
+                                  end_of_regex(); }
+#line 3906 "y.tab.c"
+    break;
+
+  case 223: /* lisp_regex: HASH_SLASH regexpr '/'  */
+#line 759 "parser.y"
+                                { (yyval.val) = cons(regex_s, (yyvsp[-1].val)); end_of_regex();
+                                  rl((yyval.val), num(lineno)); }
+#line 3913 "y.tab.c"
+    break;
+
+  case 224: /* lisp_regex: HASH_SLASH error  */
+#line 761 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("regex"));
+                                  end_of_regex(); }
+#line 3921 "y.tab.c"
+    break;
+
+  case 225: /* regexpr: regbranch  */
+#line 766 "parser.y"
+                                        { (yyval.val) = if3(cdr((yyvsp[0].val)), 
+                                                   cons(compound_s, (yyvsp[0].val)),
+                                                   car((yyvsp[0].val))); }
+#line 3929 "y.tab.c"
+    break;
+
+  case 226: /* regexpr: regexpr '|' regexpr  */
+#line 769 "parser.y"
+                                        { (yyval.val) = list(or_s, (yyvsp[-2].val), (yyvsp[0].val), nao); }
+#line 3935 "y.tab.c"
+    break;
+
+  case 227: /* regexpr: regexpr '&' regexpr  */
+#line 770 "parser.y"
+                                        { (yyval.val) = list(and_s, (yyvsp[-2].val), (yyvsp[0].val), nao); }
+#line 3941 "y.tab.c"
+    break;
+
+  case 228: /* regexpr: '~' regexpr  */
+#line 771 "parser.y"
+                                        { (yyval.val) = list(compl_s, (yyvsp[0].val), nao); }
+#line 3947 "y.tab.c"
+    break;
+
+  case 229: /* regexpr: %empty  */
+#line 772 "parser.y"
+                                        { (yyval.val) = nil; }
+#line 3953 "y.tab.c"
+    break;
+
+  case 230: /* regbranch: regterm  */
+#line 775 "parser.y"
+                                { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 3959 "y.tab.c"
+    break;
+
+  case 231: /* regbranch: regterm regbranch  */
+#line 776 "parser.y"
+                                { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 3965 "y.tab.c"
+    break;
+
+  case 232: /* regbranch: regterm '~' regexpr  */
+#line 777 "parser.y"
+                                { (yyval.val) = list((yyvsp[-2].val), list(compl_s, (yyvsp[0].val), nao), nao); }
+#line 3971 "y.tab.c"
+    break;
+
+  case 233: /* regterm: regterm '*'  */
+#line 780 "parser.y"
+                                { (yyval.val) = list(zeroplus_s, (yyvsp[-1].val), nao); }
+#line 3977 "y.tab.c"
+    break;
+
+  case 234: /* regterm: regterm '+'  */
+#line 781 "parser.y"
+                                { (yyval.val) = list(oneplus_s, (yyvsp[-1].val), nao); }
+#line 3983 "y.tab.c"
+    break;
+
+  case 235: /* regterm: regterm '?'  */
+#line 782 "parser.y"
+                                { (yyval.val) = list(optional_s, (yyvsp[-1].val), nao); }
+#line 3989 "y.tab.c"
+    break;
+
+  case 236: /* regterm: regterm '%' regexpr  */
+#line 783 "parser.y"
+                                { (yyval.val) = list(nongreedy_s, (yyvsp[-2].val), (yyvsp[0].val), nao); }
+#line 3995 "y.tab.c"
+    break;
+
+  case 237: /* regterm: '[' regclass ']'  */
+#line 784 "parser.y"
+                                { if (first((yyvsp[-1].val)) == chr('^'))
+                                  { if (rest((yyvsp[-1].val)))
+                                      (yyval.val) = cons(cset_s, rest((yyvsp[-1].val)));
+                                    else
+                                      (yyval.val) = wild_s; }
+                                  else
+                                    (yyval.val) = cons(set_s, (yyvsp[-1].val)); }
+#line 4007 "y.tab.c"
+    break;
+
+  case 238: /* regterm: '[' ']'  */
+#line 791 "parser.y"
+                                { (yyval.val) = cons(set_s, nil); }
+#line 4013 "y.tab.c"
+    break;
+
+  case 239: /* regterm: '[' error  */
+#line 792 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar,
+                                            lit("regex character class")); }
+#line 4021 "y.tab.c"
+    break;
+
+  case 240: /* regterm: '.'  */
+#line 795 "parser.y"
+                                { (yyval.val) = wild_s; }
+#line 4027 "y.tab.c"
+    break;
+
+  case 241: /* regterm: ']'  */
+#line 796 "parser.y"
+                                { (yyval.val) = chr(']'); }
+#line 4033 "y.tab.c"
+    break;
+
+  case 242: /* regterm: '-'  */
+#line 797 "parser.y"
+                                { (yyval.val) = chr('-'); }
+#line 4039 "y.tab.c"
+    break;
+
+  case 243: /* regterm: REGCHAR  */
+#line 798 "parser.y"
+                                { (yyval.val) = chr((yyvsp[0].chr)); }
+#line 4045 "y.tab.c"
+    break;
+
+  case 244: /* regterm: regtoken  */
+#line 799 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 4051 "y.tab.c"
+    break;
+
+  case 245: /* regterm: '(' regexpr ')'  */
+#line 800 "parser.y"
+                                { (yyval.val) = (yyvsp[-1].val); }
+#line 4057 "y.tab.c"
+    break;
+
+  case 246: /* regterm: '(' error  */
+#line 801 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar,
+                                             lit("regex subexpression")); }
+#line 4065 "y.tab.c"
+    break;
+
+  case 247: /* regclass: regclassterm  */
+#line 806 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 4071 "y.tab.c"
+    break;
+
+  case 248: /* regclass: regclassterm regclass  */
+#line 807 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 4077 "y.tab.c"
+    break;
+
+  case 249: /* regclassterm: regrange  */
+#line 810 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 4083 "y.tab.c"
+    break;
+
+  case 250: /* regclassterm: regchar  */
+#line 811 "parser.y"
+                                { (yyval.val) = chr((yyvsp[0].chr)); }
+#line 4089 "y.tab.c"
+    break;
+
+  case 251: /* regclassterm: regtoken  */
+#line 812 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 4095 "y.tab.c"
+    break;
+
+  case 252: /* regrange: regchar '-' regchar  */
+#line 815 "parser.y"
+                                { (yyval.val) = cons(chr((yyvsp[-2].chr)), chr((yyvsp[0].chr))); }
+#line 4101 "y.tab.c"
+    break;
+
+  case 253: /* regchar: '?'  */
+#line 817 "parser.y"
+                                { (yyval.chr) = '?'; }
+#line 4107 "y.tab.c"
+    break;
+
+  case 254: /* regchar: '.'  */
+#line 818 "parser.y"
+                                { (yyval.chr) = '.'; }
+#line 4113 "y.tab.c"
+    break;
+
+  case 255: /* regchar: '*'  */
+#line 819 "parser.y"
+                                { (yyval.chr) = '*'; }
+#line 4119 "y.tab.c"
+    break;
+
+  case 256: /* regchar: '+'  */
+#line 820 "parser.y"
+                                { (yyval.chr) = '+'; }
+#line 4125 "y.tab.c"
+    break;
+
+  case 257: /* regchar: '('  */
+#line 821 "parser.y"
+                                { (yyval.chr) = '('; }
+#line 4131 "y.tab.c"
+    break;
+
+  case 258: /* regchar: ')'  */
+#line 822 "parser.y"
+                                { (yyval.chr) = ')'; }
+#line 4137 "y.tab.c"
+    break;
+
+  case 259: /* regchar: '|'  */
+#line 823 "parser.y"
+                                { (yyval.chr) = '|'; }
+#line 4143 "y.tab.c"
+    break;
+
+  case 260: /* regchar: '~'  */
+#line 824 "parser.y"
+                                { (yyval.chr) = '~'; }
+#line 4149 "y.tab.c"
+    break;
+
+  case 261: /* regchar: '&'  */
+#line 825 "parser.y"
+                                { (yyval.chr) = '&'; }
+#line 4155 "y.tab.c"
+    break;
+
+  case 262: /* regchar: '%'  */
+#line 826 "parser.y"
+                                { (yyval.chr) = '%'; }
+#line 4161 "y.tab.c"
+    break;
+
+  case 263: /* regchar: '/'  */
+#line 827 "parser.y"
+                                { (yyval.chr) = '/'; }
+#line 4167 "y.tab.c"
+    break;
+
+  case 264: /* regchar: REGCHAR  */
+#line 828 "parser.y"
+                                { (yyval.chr) = (yyvsp[0].chr); }
+#line 4173 "y.tab.c"
+    break;
+
+  case 265: /* regtoken: REGTOKEN  */
+#line 831 "parser.y"
+                                { switch ((yyvsp[0].chr))
+                                  { case 's':
+                                      (yyval.val) = space_k; break;
+                                    case 'S':
+                                      (yyval.val) = cspace_k; break;
+                                    case 'd':
+                                      (yyval.val) = digit_k; break;
+                                    case 'D':
+                                      (yyval.val) = cdigit_k; break;
+                                    case 'w':
+                                      (yyval.val) = word_char_k; break;
+                                    case 'W':
+                                      (yyval.val) = cword_char_k; break; }}
+#line 4191 "y.tab.c"
+    break;
+
+  case 267: /* newl: error '\n'  */
+#line 846 "parser.y"
+                        { yyerror("newline expected after directive");
+                          yyerrok; }
+#line 4198 "y.tab.c"
+    break;
+
+  case 268: /* strlit: '"' '"'  */
+#line 850 "parser.y"
+                                { (yyval.val) = null_string; }
+#line 4204 "y.tab.c"
+    break;
+
+  case 269: /* strlit: '"' litchars '"'  */
+#line 851 "parser.y"
+                                { (yyval.val) = lit_char_helper((yyvsp[-1].val));
+                                  rl((yyval.val), num(lineno)); }
+#line 4211 "y.tab.c"
+    break;
+
+  case 270: /* strlit: '"' error  */
+#line 853 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("string literal")); }
+#line 4218 "y.tab.c"
+    break;
+
+  case 271: /* chrlit: HASH_BACKSLASH IDENT  */
+#line 857 "parser.y"
+                                { wchar_t ch;
+                                  val str = string_own((yyvsp[0].lexeme));
+                                  if ((yyvsp[0].lexeme)[1] == 0)
+                                  { ch = (yyvsp[0].lexeme)[0]; }
+                                  else
+                                  { ch = char_from_name((yyvsp[0].lexeme));
+                                    if (ch == L'!')
+                                    { yyerrorf(lit("unknown character name: ~a"),
+                                               str, nao); }}
+                                  end_of_char();
+                                  (yyval.val) = chr(ch); }
+#line 4234 "y.tab.c"
+    break;
+
+  case 272: /* chrlit: HASH_BACKSLASH LITCHAR  */
+#line 868 "parser.y"
+                                { (yyval.val) = chr((yyvsp[0].chr));
+                                  end_of_char(); }
+#line 4241 "y.tab.c"
+    break;
+
+  case 273: /* chrlit: HASH_BACKSLASH error  */
+#line 870 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar,
+                                             lit("character literal")); }
+#line 4249 "y.tab.c"
+    break;
+
+  case 274: /* quasilit: '`' '`'  */
+#line 875 "parser.y"
+                                { (yyval.val) = null_string; }
+#line 4255 "y.tab.c"
+    break;
+
+  case 275: /* quasilit: '`' quasi_items '`'  */
+#line 876 "parser.y"
+                                { (yyval.val) = cons(quasi_s, o_elems_transform((yyvsp[-1].val)));
+                                  rl((yyval.val), num(lineno)); }
+#line 4262 "y.tab.c"
+    break;
+
+  case 276: /* quasilit: '`' error  */
+#line 878 "parser.y"
+                                { (yyval.val) = nil;
+                                  yybadtoken(yychar, lit("string literal")); }
+#line 4269 "y.tab.c"
+    break;
+
+  case 277: /* quasi_items: quasi_item  */
+#line 882 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[0].val), nil); }
+#line 4275 "y.tab.c"
+    break;
+
+  case 278: /* quasi_items: quasi_item quasi_items  */
+#line 883 "parser.y"
+                                        { (yyval.val) = cons((yyvsp[-1].val), (yyvsp[0].val)); }
+#line 4281 "y.tab.c"
+    break;
+
+  case 279: /* quasi_item: litchars  */
+#line 886 "parser.y"
+                                { (yyval.val) = lit_char_helper((yyvsp[0].val)); }
+#line 4287 "y.tab.c"
+    break;
+
+  case 280: /* quasi_item: TEXT  */
+#line 887 "parser.y"
+                                { (yyval.val) = string_own((yyvsp[0].lexeme)); }
+#line 4293 "y.tab.c"
+    break;
+
+  case 281: /* quasi_item: o_var  */
+#line 888 "parser.y"
+                                { (yyval.val) = (yyvsp[0].val); }
+#line 4299 "y.tab.c"
+    break;
+
+  case 282: /* quasi_item: METANUM  */
+#line 889 "parser.y"
+                                { (yyval.val) = cons(var_s, cons((yyvsp[0].val), nil));
+                                  rl((yyval.val), num(lineno)); }
+#line 4306 "y.tab.c"
+    break;
+
+  case 283: /* quasi_item: list  */
+#line 891 "parser.y"
+                                { (yyval.val) = rlcp(cons(expr_s, expand((yyvsp[0].val))), (yyvsp[0].val)); }
+#line 4312 "y.tab.c"
+    break;
+
+  case 284: /* litchars: LITCHAR  */
+#line 894 "parser.y"
+                                { (yyval.val) = cons(chr((yyvsp[0].chr)), nil); }
+#line 4318 "y.tab.c"
+    break;
+
+  case 285: /* litchars: LITCHAR litchars  */
+#line 895 "parser.y"
+                                { (yyval.val) = cons(chr((yyvsp[-1].chr)), (yyvsp[0].val)); }
+#line 4324 "y.tab.c"
+    break;
+
+
+#line 4328 "y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 898 "parser.y"
+
+
+static val repeat_rep_helper(val sym, val args, val main, val parts)
+{
+  uses_or2;
+  val single_parts = nil, single_parts_p = nil;
+  val first_parts = nil, first_parts_p = nil;
+  val last_parts = nil, last_parts_p = nil;
+  val empty_parts = nil, empty_parts_p = nil;
+  val mod_parts = nil, mod_parts_p = nil;
+  val modlast_parts = nil, modlast_parts_p = nil;
+  val iter;
+
+  for (iter = parts; iter != nil; iter = cdr(iter)) {
+    val part = car(iter);
+    val sym = car(part);
+    val clauses = copy_list(cdr(part));
+
+    if (sym == single_s) {
+      single_parts = nappend2(single_parts, clauses);
+      single_parts_p = t;
+    } else if (sym == first_s) {
+      first_parts = nappend2(first_parts, clauses);
+      first_parts_p = t;
+    } else if (sym == last_s) {
+      last_parts = nappend2(last_parts, clauses);
+      last_parts_p = t;
+    } else if (sym == empty_s) {
+      empty_parts = nappend2(empty_parts, clauses);
+      empty_parts_p = t;
+    } else if (sym == mod_s) {
+      mod_parts = cons(clauses, mod_parts);
+      mod_parts_p = t;
+    } else if (sym == modlast_s) {
+      modlast_parts = cons(clauses, modlast_parts);
+      modlast_parts_p = t;
+    } else {
+      abort();
+    }
+  }
+
+  single_parts = or2(single_parts, single_parts_p);
+  first_parts = or2(first_parts, first_parts_p);
+  last_parts = or2(last_parts, last_parts_p);
+  empty_parts = or2(empty_parts, empty_parts_p);
+  mod_parts = or2(nreverse(mod_parts), mod_parts_p);
+  modlast_parts = or2(nreverse(modlast_parts), modlast_parts_p);
+
+  return list(sym, args, main, single_parts, first_parts,
+              last_parts, empty_parts, nreverse(mod_parts),
+              nreverse(modlast_parts), nao);
+}
+
+static val o_elems_transform(val o_elems)
+{
+  list_collect_decl(o_elems_out, ptail);
+  val iter;
+
+  for (iter = o_elems; iter; iter = cdr(iter)) {
+    val elem = car(iter);
+
+    while (consp(elem) && first(elem) == var_s) {
+      val sym = second(elem);
+      val pat = third(elem);
+      val modifiers = fourth(elem);
+
+      list_collect(ptail, list(first(elem), sym, nil, modifiers, nao));
+      elem = pat;
+    }
+
+    if (elem)
+      list_collect(ptail, elem);
+  }
+  
+  return o_elems_out;
+}
+
+static val define_transform(val define_form)
+{
+  val sym = first(define_form);
+  val args = second(define_form);
+
+  if (define_form == nil)
+    return nil;
+
+  assert (sym == define_s);
+
+  if (args == nil) {
+    yyerror("define requires arguments");
+    return define_form;
+  }
+
+  if (!consp(args) || !listp(cdr(args))) {
+    yyerror("bad define argument syntax");
+    return define_form;
+  } else {
+    val name = first(args);
+    val params = second(args);
+
+    if (!symbolp(name)) {
+      yyerror("function name must be a symbol");
+      return define_form;
+    }
+
+    if (!proper_listp(params)) {
+      yyerror("invalid function parameter list");
+      return define_form;
+    }
+
+    if (!all_satisfy(params, func_n1(symbolp), nil))
+      yyerror("function parameters must be symbols");
+  }
+
+  return define_form;
+}
+
+static val lit_char_helper(val litchars)
+{
+  val ret = nil;
+
+  if (litchars) {
+    val len = length_list(litchars), iter, ix;
+    ret = mkustring(len);
+    for (iter = litchars, ix = zero;
+        iter;
+        iter = cdr(iter), ix = plus(ix, one))
+    {
+      chr_str_set(ret, ix, car(iter));
+    }
+  } else {
+    ret = nil;
+  }
+  return ret;
+}
+
+static val optimize_text(val text_form)
+{
+  if (all_satisfy(rest(text_form), func_n1(stringp), nil))
+    return cat_str(rest(text_form), lit(""));
+  return text_form;
+}
+
+static val unquotes_occur(val quoted_form)
+{
+  uses_or2;
+
+  if (atom(quoted_form)) {
+    return nil;
+  } else {
+    val sym = car(quoted_form);
+    if (sym == unquote_s || sym == splice_s)
+      return t;
+    if (sym == quote_s)
+      return nil;
+    return or2(unquotes_occur(sym), unquotes_occur(cdr(quoted_form)));
+  }
+}
+
+static val choose_quote(val quoted_form)
+{
+  return unquotes_occur(quoted_form) ? qquote_s : quote_s;
+}
+
+val rl(val form, val lineno)
+{
+  sethash(form_to_ln_hash, form, cons(lineno, spec_file_str));
+  return form;
+}
+
+val rlset(val form, val info)
+{
+  sethash(form_to_ln_hash, form, info);
+  return form;
+}
+
+static wchar_t char_from_name(wchar_t *name)
+{
+  static struct {
+    const wchar_t *name;
+    const wchar_t ch;
+  } map[] = {
+    { L"nul", 0 },
+    { L"alarm", L'\a' },
+    { L"backspace", L'\b' },
+    { L"tab", L'\t' },
+    { L"linefeed", L'\n' },
+    { L"newline", L'\n' },
+    { L"vtab", L'\v' },
+    { L"page", L'\f' },
+    { L"return", L'\r' },
+    { L"esc", 27 },
+    { L"space", L' ' },
+    { 0, 0 },
+  };
+  int i;
+
+  for (i = 0; map[i].name; i++) {
+    if (wcscmp(map[i].name, name) == 0)
+      return map[i].ch;
+  }
+
+  return L'!'; /* code meaning not found */
+}
+
+val get_spec(void)
+{
+  return parsed_spec;
+}
+
+#ifndef YYEOF
+#define YYEOF 0
+#endif
+
+void yybadtoken(int tok, val context)
+{
+  val problem = nil;
+
+  switch (tok) {
+  case ERRTOK:
+    return;
+  case SPACE:   problem = lit("space"); break;
+  case TEXT:    problem = lit("text"); break;
+  case IDENT:   problem = lit("identifier"); break;
+  case KEYWORD: problem = lit("keyword"); break;
+  case METAVAR: problem = lit("metavar"); break;
+  case METANUM: problem = lit("metanum"); break;
+  case ALL:     problem = lit("\"all\""); break;
+  case SOME:    problem = lit("\"some\""); break;
+  case NONE:    problem = lit("\"none\""); break;
+  case MAYBE:   problem = lit("\"maybe\""); break;
+  case CASES:   problem = lit("\"cases\""); break;
+  case CHOOSE:  problem = lit("\"choose\""); break;
+  case AND:     problem = lit("\"and\""); break;
+  case OR:      problem = lit("\"or\""); break;
+  case END:     problem = lit("\"end\""); break;
+  case COLLECT: problem = lit("\"collect\""); break;
+  case UNTIL:   problem = lit("\"until\""); break;
+  case COLL:    problem = lit("\"coll\""); break;
+  case OUTPUT:  problem = lit("\"output\""); break;
+  case REPEAT:  problem = lit("\"repeat\""); break;
+  case REP:     problem = lit("\"rep\""); break;
+  case SINGLE:  problem = lit("\"single\""); break;
+  case FIRST:   problem = lit("\"first\""); break;
+  case LAST:    problem = lit("\"last\""); break;
+  case EMPTY:   problem = lit("\"empty\""); break;
+  case DEFINE:  problem = lit("\"define\""); break;
+  case TRY:     problem = lit("\"try\""); break;
+  case CATCH:   problem = lit("\"catch\""); break;
+  case FINALLY: problem = lit("\"finally\""); break;
+  case NUMBER:  problem = lit("number"); break;
+  case REGCHAR: problem = lit("regular expression character"); break;
+  case REGTOKEN: problem = lit("regular expression token"); break;
+  case LITCHAR: problem = lit("string literal character"); break;
+  case METAPAR: problem = lit("@("); break;
+  case METABKT: problem = lit("@["); break;
+  case DOTDOT: problem = lit(".."); break;
+  case HASH_BACKSLASH: problem = lit("#\\"); break;
+  case HASH_SLASH:     problem = lit("#/"); break;
+  }
+
+  if (problem != 0)
+    if (context)
+      yyerrorf(lit("misplaced ~a in ~a"), problem, context, nao);
+    else
+      yyerrorf(lit("unexpected ~a"), problem, nao);
+  else
+    if (context) /* Byacc sets yychar to 0 */
+      if (tok == YYEOF || tok == YYEMPTY)
+        yyerrorf(lit("unterminated ~a"), context, nao);
+      else if (tok == '\n')
+        yyerrorf(lit("newline in ~a"), context, nao);
+      else
+        yyerrorf(lit("misplaced character ~a in ~a"), chr(tok), context, nao);
+    else
+      if (tok == YYEOF)
+        yyerrorf(lit("unexpected end of input"), nao);
+      else if (tok == YYEMPTY)
+        return;
+      else
+        yyerrorf(lit("unexpected ~s"), chr(tok), nao);
+}
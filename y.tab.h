@@ -0,0 +1,184 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SPACE = 258,                   /* SPACE  */
+    TEXT = 259,                    /* TEXT  */
+    IDENT = 260,                   /* IDENT  */
+    KEYWORD = 261,                 /* KEYWORD  */
+    METAVAR = 262,                 /* METAVAR  */
+    ALL = 263,                     /* ALL  */
+    SOME = 264,                    /* SOME  */
+    NONE = 265,                    /* NONE  */
+    MAYBE = 266,                   /* MAYBE  */
+    CASES = 267,                   /* CASES  */
+    BLOCK = 268,                   /* BLOCK  */
+    CHOOSE = 269,                  /* CHOOSE  */
+    GATHER = 270,                  /* GATHER  */
+    AND = 271,                     /* AND  */
+    OR = 272,                      /* OR  */
+    END = 273,                     /* END  */
+    COLLECT = 274,                 /* COLLECT  */
+    UNTIL = 275,                   /* UNTIL  */
+    COLL = 276,                    /* COLL  */
+    OUTPUT = 277,                  /* OUTPUT  */
+    REPEAT = 278,                  /* REPEAT  */
+    REP = 279,                     /* REP  */
+    SINGLE = 280,                  /* SINGLE  */
+    FIRST = 281,                   /* FIRST  */
+    LAST = 282,                    /* LAST  */
+    EMPTY = 283,                   /* EMPTY  */
+    MOD = 284,                     /* MOD  */
+    MODLAST = 285,                 /* MODLAST  */
+    DEFINE = 286,                  /* DEFINE  */
+    TRY = 287,                     /* TRY  */
+    CATCH = 288,                   /* CATCH  */
+    FINALLY = 289,                 /* FINALLY  */
+    ERRTOK = 290,                  /* ERRTOK  */
+    HASH_BACKSLASH = 291,          /* HASH_BACKSLASH  */
+    HASH_SLASH = 292,              /* HASH_SLASH  */
+    DOTDOT = 293,                  /* DOTDOT  */
+    HASH_H = 294,                  /* HASH_H  */
+    NUMBER = 295,                  /* NUMBER  */
+    METANUM = 296,                 /* METANUM  */
+    REGCHAR = 297,                 /* REGCHAR  */
+    REGTOKEN = 298,                /* REGTOKEN  */
+    LITCHAR = 299,                 /* LITCHAR  */
+    METAPAR = 300,                 /* METAPAR  */
+    METABKT = 301,                 /* METABKT  */
+    SPLICE = 302,                  /* SPLICE  */
+    LOW = 303                      /* LOW  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define SPACE 258
+#define TEXT 259
+#define IDENT 260
+#define KEYWORD 261
+#define METAVAR 262
+#define ALL 263
+#define SOME 264
+#define NONE 265
+#define MAYBE 266
+#define CASES 267
+#define BLOCK 268
+#define CHOOSE 269
+#define GATHER 270
+#define AND 271
+#define OR 272
+#define END 273
+#define COLLECT 274
+#define UNTIL 275
+#define COLL 276
+#define OUTPUT 277
+#define REPEAT 278
+#define REP 279
+#define SINGLE 280
+#define FIRST 281
+#define LAST 282
+#define EMPTY 283
+#define MOD 284
+#define MODLAST 285
+#define DEFINE 286
+#define TRY 287
+#define CATCH 288
+#define FINALLY 289
+#define ERRTOK 290
+#define HASH_BACKSLASH 291
+#define HASH_SLASH 292
+#define DOTDOT 293
+#define HASH_H 294
+#define NUMBER 295
+#define METANUM 296
+#define REGCHAR 297
+#define REGTOKEN 298
+#define LITCHAR 299
+#define METAPAR 300
+#define METABKT 301
+#define SPLICE 302
+#define LOW 303
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 62 "parser.y"
+
+  wchar_t *lexeme;
+  union obj *val;
+  wchar_t chr;
+  cnum lineno;
+
+#line 170 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */